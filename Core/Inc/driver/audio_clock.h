@@ -0,0 +1,41 @@
+/**
+  ******************************************************************************
+  * @file    audio_clock.h
+  * @author  Bianchi Davide
+  * @brief   This file contains all the prototypes for the audio_clock.c
+  *
+  *          The I2S3 sample rate with MCLK out (256*fs, 16 bit) is
+  *            fs = (vco_input * PLLI2SN / PLLI2SR) / (256 * (2*I2SDIV + ODD))
+  *          The divisors closest to the nominal rate are searched at runtime
+  *          and the real rate they give is published to the dsp.
+  ******************************************************************************
+**/
+
+#include "main.h"	/* Error_Handler() */
+#include "parameters.h"
+
+#ifndef INC_DRIVER_AUDIO_CLOCK_H_
+#define INC_DRIVER_AUDIO_CLOCK_H_
+
+#define PLLI2S_VCO_MIN		100000000.0f	// Hz
+#define PLLI2S_VCO_MAX		432000000.0f
+#define PLLI2S_N_MIN		50
+#define PLLI2S_N_MAX		432
+#define PLLI2S_R_MIN		2
+#define PLLI2S_R_MAX		7
+#define I2S_DIVIDER_MIN		4				// 2*I2SDIV + ODD, I2SDIV >= 2
+#define I2S_DIVIDER_MAX		511
+
+/* ========== Base structure ========== */
+typedef struct {
+	uint32_t plli2sn;
+	uint32_t plli2sr;
+	uint32_t divider;		// 2*I2SDIV + ODD
+	float rate;				// Real sample rate, Hz
+} AudioClock;
+
+/* ========== Exported functions ========== */
+float findAudioClock	(AudioClock *clock, float rate, float vco_input);
+float setAudioClock		(I2S_HandleTypeDef *hi2s, AudioClock *clock, float rate);
+
+#endif /* INC_DRIVER_AUDIO_CLOCK_H_ */
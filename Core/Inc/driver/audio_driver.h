@@ -0,0 +1,94 @@
+/**
+  ******************************************************************************
+  * @file    audio_driver.h
+  * @author  Bianchi Davide
+  * @brief   This file contains all the prototypes for the audio_driver.c
+  *
+  * 		 The I2S DMA interrupt only marks the free half of the circular
+  * 		 buffer and pends PendSV, the half is rendered in PendSV.
+  * 		 Priority scheme (NVIC_PRIORITYGROUP_4, 0 is the highest):
+  * 		   0   DMA1_Stream7   I2S half/full transfer, a few cycles
+  * 		   1   OTG_FS         USB host, MIDI input
+  * 		   1   USART2         DIN MIDI input, idle line (driver/midi_uart.h)
+  * 		   1   DMA1_Stream5   DIN MIDI input, half/full buffer
+  * 		   2   DMA2_Stream0   ADC pots
+  * 		   2   EXTI           Switches
+  * 		   14  SysTick        HAL tick
+  * 		   15  PendSV         Audio rendering
+  * 		 The main loop (USB host process, MIDI decoding) runs below all of them.
+  *
+  * 		 Only the render writes the synth. The ADC and EXTI interrupts
+  * 		 preempt it, so they just latch the pots and the switches
+  * 		 (audioDriverLatchAnalog(), audioDriverLatchDigital()): the render
+  * 		 applies them at the start of the next half, never in the middle
+  * 		 of a block.
+  *
+  * 		 The MIDI messages reach the synth only through events, one queue
+  * 		 per input (enum MidiSource) that the render drains at the start of
+  * 		 every half, the oldest event first. An event that arrived
+  * 		 during the last period plays at the same position in the half,
+  * 		 one period later: the latency is steady and the timing is exact
+  * 		 to the sample instead of jumping to the block boundaries.
+  ******************************************************************************
+**/
+
+#include "parameters.h"
+#include "dsp/synthesizer.h"
+#include "utils/cycle_counter.h"
+#include "utils/governor.h"
+#include "utils/profiler.h"
+#include "utils/event_queue.h"
+#include "utils/midi_decoder.h"
+#include "driver/audio_clock.h"
+
+#ifndef INC_DRIVER_AUDIO_DRIVER_H_
+#define INC_DRIVER_AUDIO_DRIVER_H_
+
+/* ========== Base structure ========== */
+typedef struct {
+	Synthesizer *synth;
+	I2S_HandleTypeDef *hi2s;
+	AudioClock clock;				// PLLI2S and I2S prescaler
+	enum SampleRate rate;			// Nominal
+	float sr;						// Real, given to the dsp
+	volatile enum SampleRate requested_rate;	// Applied by audioDriverProcess()
+	int16_t *buffer;				// Circular I2S buffer, I2S_BUFFER_SIZE(MAX_BUFFER_SIZE) samples
+	uint16_t frames;				// Stereo frames of a half, the latency
+	uint16_t length;				// Samples in use: I2S_BUFFER_SIZE(frames)
+	volatile uint16_t requested_frames;	// Applied by audioDriverProcess()
+	int16_t * volatile pending;		// Half to render, NULL when none
+	Governor governor;				// Steps the quality down when the render gets late
+	EventQueue events[MIDI_SOURCE_COUNT];	// MIDI from every input, applied by the render
+
+	// Controls latched by their interrupts, applied by the render
+	uint16_t adc_values[NUM_ADC_CHANNELS];	// Last scan of the pots
+	volatile bool adc_pending;
+	volatile uint16_t pins_pending;		// Bit n: EXTI line n fired
+
+	// Deadline instrumentation, read with the debugger (core cycles)
+	uint32_t period_cycles;			// Between two half-buffer interrupts
+	volatile uint32_t event_time;	// Cycle counter at the last half-buffer interrupt
+	volatile uint32_t render_cycles;	// Last getSynthAudioBlock()
+	volatile uint32_t max_render_cycles;
+	volatile int32_t slack_cycles;		// Left before the deadline by the last block
+	volatile int32_t min_slack_cycles;
+	volatile uint32_t blocks;			// Rendered
+	volatile uint32_t underruns;		// Finished after the DMA started reading the half (NDTR)
+	volatile uint32_t dropped_blocks;	// Never rendered, the next half came first
+	volatile uint32_t event_latency_cycles[MIDI_SOURCE_COUNT];	// Arrival of the last event to its render
+	volatile uint32_t max_event_latency_cycles[MIDI_SOURCE_COUNT];
+} AudioDriver;
+
+/* ========== Exported functions ========== */
+void setupAudioDriver	(AudioDriver *driver, Synthesizer *synth, I2S_HandleTypeDef *hi2s, int16_t *buffer, enum SampleRate rate);
+void startAudioDriver	(AudioDriver *driver);
+void requestAudioBufferSize(AudioDriver *driver, int frames);
+void requestAudioSampleRate(AudioDriver *driver, enum SampleRate rate);
+void audioDriverProcess	(AudioDriver *driver);
+void audioDriverHalfDone(AudioDriver *driver, int half);
+void audioDriverLatchAnalog(AudioDriver *driver, const uint16_t *adc_values);
+void audioDriverLatchDigital(AudioDriver *driver, uint16_t pin);
+void audioDriverRender	(AudioDriver *driver);
+void resetAudioDriverStats(AudioDriver *driver);
+
+#endif /* INC_DRIVER_AUDIO_DRIVER_H_ */
@@ -0,0 +1,49 @@
+/**
+  ******************************************************************************
+  * @file    midi_uart.h
+  * @author  Bianchi Davide
+  * @brief   This file contains all the prototypes for the midi_uart.c
+  *
+  * 		 DIN MIDI input on USART2 (PA3, AF7) at 31250 baud. DMA1_Stream5
+  * 		 (channel 4) fills a circular buffer: the CPU only runs at the
+  * 		 idle line (end of a burst) and at the half/full buffer (a burst
+  * 		 longer than half of it), never per byte. Both interrupts have
+  * 		 the same priority, so they never preempt each other and the
+  * 		 queue keeps a single producer.
+  ******************************************************************************
+**/
+
+#include "parameters.h"
+#include "utils/event_queue.h"
+#include "utils/midi_decoder.h"
+#include "utils/cycle_counter.h"
+
+#ifndef INC_DRIVER_MIDI_UART_H_
+#define INC_DRIVER_MIDI_UART_H_
+
+#define MIDI_BAUD_RATE			31250
+#define MIDI_BYTE_BITS			10		// Start, 8 data, stop
+#define MIDI_UART_BUFFER_SIZE	64		// 20 ms of dense traffic, the interrupts come every 10 ms
+#define MIDI_UART_PRIORITY		1		// Same as the USB host
+
+/* ========== Base structure ========== */
+typedef struct {
+	USART_TypeDef *usart;
+	DMA_Stream_TypeDef *dma;
+	MidiParser parser;
+	EventQueue *queue;				// Of the audio driver, MIDI_SOURCE_DIN
+	uint8_t buffer[MIDI_UART_BUFFER_SIZE];
+	uint16_t position;				// Next byte to parse
+	uint32_t byte_cycles;			// Core cycles of a byte on the wire
+
+	// Read with the debugger
+	volatile uint32_t bytes;
+	volatile uint32_t line_errors;	// Framing and noise, a bad cable or a wrong baud rate
+} MidiUart;
+
+/* ========== Exported functions ========== */
+void setupMidiUart	(MidiUart *uart, EventQueue *queue);
+void midiUartIrq	(MidiUart *uart);
+void midiUartDmaIrq	(MidiUart *uart);
+
+#endif /* INC_DRIVER_MIDI_UART_H_ */
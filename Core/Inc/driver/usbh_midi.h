@@ -3,6 +3,21 @@
   * @file    usbh_midi.h
   * @author  Bianchi Davide
   * @brief   This file contains all the prototypes for the usbh_midi.c
+  *
+  *          The reception is double buffered and driven by the OTG_FS
+  *          interrupt: when a bulk IN transfer ends, USBH_MIDI_NotifyURBChange()
+  *          stamps it with the SOF of its frame (frame number and cycle
+  *          counter, see USBH_MIDI_SOFProcess()) and submits the next one in
+  *          the other buffer at once.
+  *          The main loop (USBH_MIDI_Process()) only hands the completed
+  *          buffers to USBH_MIDI_ReceiveCallback(), in order. With both
+  *          buffers full the next transfer waits for the main loop: the
+  *          device is NAKed, nothing is lost.
+  *
+  *          The transmission takes the packets of a MidiTxQueue
+  *          (USBH_MIDI_TransmitQueue()) from the main loop: as soon as the
+  *          previous transfer is done, all the packets queued meanwhile go
+  *          in the next one, up to a full 64 byte transfer.
   ******************************************************************************
 **/
 
@@ -12,6 +27,10 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "usbh_core.h"
+#include "utils/midi_tx_queue.h"
+
+#define USBH_MIDI_RX_BUFFERS    2       // Ping-pong: one transfer in flight while the other one is decoded
+#define USBH_MIDI_TX_TRANSFER   64      // Largest bulk OUT transfer packed from the queue (full speed endpoint)
 
 
 /** @defgroup USBH_MIDI_CORE_Exported_Types
@@ -59,12 +78,21 @@
     {
         MIDI_DataItfTypedef                DataItf;
         uint8_t                           *pTxData;
-        uint8_t                           *pRxData;
+        MidiTxQueue                       *pTxQueue;                            // Packets to send, NULL when not used
+        uint8_t                            TxBuffer[USBH_MIDI_TX_TRANSFER];    // Packets of the transfer in flight
+        uint8_t                           *pRxBuffer[USBH_MIDI_RX_BUFFERS];    // Ping-pong reception buffers
         uint32_t                           TxDataLength;
-        uint32_t                           RxDataLength;
+        uint32_t                           RxDataLength;                        // Size of each reception buffer
+        volatile uint16_t                  RxLength[USBH_MIDI_RX_BUFFERS];     // Bytes received, 0 while the buffer is free
+        volatile uint32_t                  RxTime[USBH_MIDI_RX_BUFFERS];       // Cycle counter at the SOF of the frame of the transfer
+        volatile uint32_t                  RxFrame[USBH_MIDI_RX_BUFFERS];      // Frame number of the transfer (phost->Timer), read with the debugger
+        volatile uint32_t                  SofTime;                             // Cycle counter at the last SOF
+        volatile uint8_t                   RxFill;                              // Buffer of the transfer in flight (interrupt)
+        uint8_t                            RxRead;                              // Next buffer to deliver (main loop)
+        volatile uint32_t                  RxStalls;                            // Both buffers full at the end of a transfer, read with the debugger
         MIDI_StateTypeDef                  state;
         MIDI_DataStateTypeDef              data_tx_state;
-        MIDI_DataStateTypeDef              data_rx_state;
+        volatile MIDI_DataStateTypeDef     data_rx_state;                       // Written by the main loop and by the interrupt
         uint8_t                            Rx_Poll;
     }
     MIDI_HandleTypeDef;
@@ -118,11 +146,13 @@
   */
 
     USBH_StatusTypeDef  USBH_MIDI_Transmit(USBH_HandleTypeDef *phost, uint8_t *pbuff, uint32_t length);
+    USBH_StatusTypeDef  USBH_MIDI_TransmitQueue(USBH_HandleTypeDef *phost, MidiTxQueue *queue);
     USBH_StatusTypeDef  USBH_MIDI_Receive (USBH_HandleTypeDef *phost, uint8_t *pbuff, uint32_t length);
     uint16_t            USBH_MIDI_GetLastReceivedDataSize(USBH_HandleTypeDef *phost);
     USBH_StatusTypeDef  USBH_MIDI_Stop(USBH_HandleTypeDef *phost);
     void 				USBH_MIDI_TransmitCallback(USBH_HandleTypeDef *phost);
-    void 				USBH_MIDI_ReceiveCallback(USBH_HandleTypeDef *phost);
+    void 				USBH_MIDI_ReceiveCallback(USBH_HandleTypeDef *phost, uint8_t *pbuff, uint16_t length, uint32_t time);   // time: RxTime
+    void                USBH_MIDI_NotifyURBChange(USBH_HandleTypeDef *phost, uint8_t pipe, USBH_URBStateTypeDef urb_state);
 /**
   * @}
   */
@@ -7,17 +7,27 @@
 **/
 
 #include "parameters.h"
+#include "utils/memory_sections.h"
 
 #ifndef INC_DSP_ADSR_H_
 #define INC_DSP_ADSR_H_
 
+#define ADSR_TABLE_SIZE		256			// Segment times, indexed by the pot value >> 4
+#define ADSR_MIN_TIME		0.0005f		// Seconds of the first entry
+#define ADSR_MAX_TIME		5.0f		// Seconds of the last entry
+#define ADSR_EPSILON		0.001f		// -60 dB: a segment is over this close to its target
+#define ADSR_ATTACK_TARGET	(1.0f/(1.0f - ADSR_EPSILON))	// Reached 1 exactly after the attack time
+
 /* ========== Base structure ========== */
 typedef struct {
 	float sr;
-	float attack;
+	float attack_coeff;		// One-pole coefficients of the segments
+	float decay_coeff;
+	float release_coeff;
+	float attack;			// Pot values, the coefficients are looked up again at a new sample rate
+	float decay;
 	float release;
-	float sample_value;
-	float step;
+	float sustain;			// Level [0, 1]
 	float env;
 	uint8_t reset_voice;
 	enum AdsrState state;
@@ -25,11 +35,14 @@ typedef struct {
 
 /* ========== Exported functions ========== */
 void setupAdsr(Adsr *adsr, float sr);
+void setAdsrSampleRate(Adsr *adsr, float sr);
 void setAdsrAttack(Adsr *adsr, float attack);
+void setAdsrDecay(Adsr *adsr, float decay);
+void setAdsrSustain(Adsr *adsr, float sustain);
 void setAdsrRelease(Adsr *adsr, float release);
 void adsrNoteOn(Adsr *adsr);
 void adsrNoteOff(Adsr *adsr);
-void getAdsrAudioBlock(Adsr *adsr, float *out_buffer);
+void getAdsrAudioBlock(Adsr *adsr, float *buffer, int length);
 float getAdsrEnvelope(Adsr *adsr);
 
 #endif /* INC_DSP_ADSR_H_ */
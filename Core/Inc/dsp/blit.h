@@ -7,10 +7,15 @@
 **/
 
 #include "parameters.h"
+#include "dsp/tables.h"
+#include "utils/memory_sections.h"
 
 #ifndef INC_DSP_BLIT_H_
 #define INC_DSP_BLIT_H_
 
+#define BLIT_RING_SIZE		BLIT_TABLE_TAPS		// One impulse in flight per edge, power of 2
+#define BLIT_RING_MASK		(BLIT_RING_SIZE - 1)
+
 /* ========== Base structure ========== */
 typedef struct {
 	// Base variable
@@ -34,14 +39,13 @@ typedef struct {
 	int sample_cont;
 	bool passed_neg;
 	unsigned char index;
-	float p_blit[256];
-	float n_blit[256];
-	float blits_matrix[256][16];
+	float p_blit[BLIT_RING_SIZE];
+	float n_blit[BLIT_RING_SIZE];
 } Blit;
 
 /* ========== Exported functions ========== */
 void setupBlit   			(Blit *blit, float sr);
-void createBlitTable		(Blit *blit);
+void setBlitSampleRate	(Blit *blit, float sr);
 void getPositiveBlit		(Blit *blit);
 void getNegativeBlit		(Blit *blit);
 bool negativeEdgeCrossed	(Blit *blit);
@@ -53,5 +57,10 @@ float getTriSample		(Blit *blit, float f);
 float getSawSample		(Blit *blit, float f);
 float getSquareSample	(Blit *blit, float f);
 
+void getBlitAudioBlock	(Blit *blit, float f, int waveform, float *out_buffer, int length);
+void getTriAudioBlock	(Blit *blit, float f, float *out_buffer, int length);
+void getSawAudioBlock	(Blit *blit, float f, float *out_buffer, int length);
+void getSquareAudioBlock(Blit *blit, float f, float *out_buffer, int length);
+
 #endif /* INC_DSP_BLIT_H_ */
 
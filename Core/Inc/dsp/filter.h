@@ -7,6 +7,10 @@
 **/
 
 #include "parameters.h"
+#include "dsp/saturator.h"
+#include "dsp/tables.h"
+#include "utils/fast_math.h"
+#include "utils/memory_sections.h"
 
 #ifndef INC_DSP_FILTER_H_
 #define INC_DSP_FILTER_H_
@@ -20,8 +24,15 @@ typedef struct {
 	float g;
 	float Glp;
 	float Gtot;
+	float inv_den;		// 1/(1 + k*Gtot), the division of the feedback solution
 	float coeff;
 
+	// Per-sample increments towards the cutoff of the control block
+	float g_step;
+	float Glp_step;
+	float inv_den_step;
+	enum Saturator saturator;
+
 	float v[4];
 	float s[4];
 	float y[4];
@@ -29,9 +40,12 @@ typedef struct {
 
 /* ========== Exported functions ========== */
 void setupFilter		(Filter *filter, float sr);
+void setFilterSampleRate(Filter *filter, float sr);
 void updateFilterCutoff	(Filter *filter, float cutoff);
+void setFilterCutoffRamp(Filter *filter, float cutoff, float inv_length);
 void setFilterResonance	(Filter *filter, float resonance);
-void getFilterAudioBlock(Filter *filter, float *fm_buffer, float *out_buffer);
+void setFilterSaturator	(Filter *filter, enum Saturator saturator);
+void getFilterAudioBlock(Filter *filter, float *buffer, int length);
 float getFilterSample	(Filter *filter, float x);
 
 #endif /* INC_DSP_FILTER_H_ */
@@ -7,26 +7,35 @@
 **/
 
 #include "parameters.h"
+#include "dsp/tables.h"
 
 #ifndef INC_DSP_LFO_H_
 #define INC_DSP_LFO_H_
 
+#define LFO_PHASE_SCALE		4294967296.0f	// One period of the 32-bit phase accumulator
+
 /* ========== Base structure ========== */
 typedef struct {
 	float sr;
 	float f;
+	float gain;
 	float sample_value;
-	float phase_increment;
-	float phase_value;
-	enum Waveform waveform;
+	float phase_scale;			// LFO_PHASE_SCALE/sr, increment of 1 Hz
+	uint32_t phase_increment;
+	uint32_t phase_value;		// [0, 2^32) is one period
+	uint32_t random_seed;		// Sample and hold generator
+	float hold_value;
+	enum LfoWaveform waveform;
 } Lfo;
 
 /* ========== Exported functions ========== */
 void 	setupLfo    	(Lfo *lfo, float sr);
+void 	setLfoSampleRate(Lfo *lfo, float sr);
 void 	setLfoFrequency	(Lfo *lfo, float f);
 void 	setLfoWaveform	(Lfo *lfo, int waveform);
-void 	getLfoAudioBlock(Lfo *lfo, float *out_buffer);
+void 	setLfoGain		(Lfo *lfo, float gain);
+void 	getLfoAudioBlock(Lfo *lfo, float *out_buffer, int length);
 float 	getLfoSample	(Lfo *lfo);
+float 	getLfoControlSample(Lfo *lfo, int length);
 
 #endif /* INC_DSP_LFO_H_ */
-
@@ -7,6 +7,7 @@
 **/
 
 #include "parameters.h"
+#include "utils/memory_sections.h"
 
 #ifndef INC_DSP_MIXER_H_
 #define INC_DSP_MIXER_H_
@@ -26,6 +27,6 @@ void setMuteOsc1(Mixer *mixer, bool mute1);
 void setMuteOsc2(Mixer *mixer, bool mute2);
 void setGainOsc1(Mixer *mixer, float gain1);
 void setGainOsc2(Mixer *mixer, float gain2);
-void getMixerAudioBlock(Mixer *mixer, float *out_buffer, float *buffer_osc1, float *buffer_osc2);
+void getMixerAudioBlock(Mixer *mixer, float *out_buffer, float *buffer_osc1, float *buffer_osc2, int length);
 
 #endif /* INC_DSP_MIXER_H_ */
@@ -9,6 +9,7 @@
 #include "parameters.h"
 #include "dsp/blit.h"
 #include "dsp/lfo.h"
+#include "utils/memory_sections.h"
 
 #ifndef INC_DSP_OSC_H_
 #define INC_DSP_OSC_H_
@@ -25,9 +26,10 @@ typedef struct {
 
 /* ========== Exported functions ========== */
 void setupOsc				(Osc *osc, float sr);
+void setOscSampleRate		(Osc *osc, float sr);
 void setOscWaveform			(Osc *osc, int waveform);
 void setOscFrequency		(Osc *osc, float frequency);
-void getOscAudioBlock		(Osc *osc, float *fm_buffer, float *out_buffer);
+void getOscAudioBlock		(Osc *osc, float *out_buffer, int length);
 float getOscSample			(Osc *osc);
 void clearOscAccumulators	(Osc *osc);
 
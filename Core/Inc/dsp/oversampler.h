@@ -0,0 +1,47 @@
+/**
+  ******************************************************************************
+  * @file    oversampler.h
+  * @author  Bianchi Davide
+  * @brief   This file contains all the prototypes for the oversampler.c
+  ******************************************************************************
+**/
+
+#include "parameters.h"
+#include "dsp/tables.h"
+#include "utils/memory_sections.h"
+
+#ifndef INC_DSP_OVERSAMPLER_H_
+#define INC_DSP_OVERSAMPLER_H_
+
+#if OVERSAMPLING_MAX >= 4
+#define OVERSAMPLING_STAGES		2
+#else
+#define OVERSAMPLING_STAGES		1
+#endif
+
+#define HALFBAND_UP_HISTORY		(2*HALFBAND_1_TAPS - 1)		// Base-rate inputs kept by the interpolator
+#define HALFBAND_DOWN_HISTORY	(4*HALFBAND_1_TAPS - 3)		// High-rate inputs kept by the decimator
+
+/* ========== Base structure ========== */
+// One 2x half-band stage, used both to interpolate and to decimate
+typedef struct {
+	const float *coeffs;	// Odd-phase taps (the centre one is 0.5, the even ones are 0)
+	int taps;
+	float up_history[HALFBAND_UP_HISTORY];
+	float down_history[HALFBAND_DOWN_HISTORY];
+} HalfbandStage;
+
+typedef struct {
+	int factor;				// 1, 2 or 4 (up to OVERSAMPLING_MAX)
+	float inv_factor;
+	HalfbandStage stages[OVERSAMPLING_STAGES];	// stages[0] at the base rate
+} Oversampler;
+
+/* ========== Exported functions ========== */
+void setupOversampler		(Oversampler *os);
+void setOversamplerFactor	(Oversampler *os, int factor);
+void clearOversampler		(Oversampler *os);
+void upsampleAudioBlock		(Oversampler *os, float *in_buffer, float *out_buffer, int length);
+void downsampleAudioBlock	(Oversampler *os, float *in_buffer, float *out_buffer, int length);
+
+#endif /* INC_DSP_OVERSAMPLER_H_ */
@@ -0,0 +1,31 @@
+/**
+  ******************************************************************************
+  * @file    pitch.h
+  * @author  Bianchi Davide
+  * @brief   This file contains the conversions of the pitch engine: the
+  * 		 pitch is carried in semitones (fractional MIDI notes) and turned
+  * 		 into hertz once per control block.
+  ******************************************************************************
+**/
+
+#include "parameters.h"
+#include "utils/fast_math.h"
+
+#ifndef INC_DSP_PITCH_H_
+#define INC_DSP_PITCH_H_
+
+#define PITCH_REFERENCE_NOTE	69			// A4
+#define PITCH_REFERENCE_HERTZ	440.0f
+
+/* ========== Exported functions ========== */
+// Any note in [0, 127] and beyond, 0.008 cents of error
+static inline float noteToHertz(float note) {
+	return PITCH_REFERENCE_HERTZ * fastExp2f((note - PITCH_REFERENCE_NOTE) * (1.0f/12.0f));
+}
+
+// Pitch wheel [0, 1] (0.5 at rest) -> semitones in [-range, +range]
+static inline float bendToSemitones(float pitch_bend, float range) {
+	return (pitch_bend - 0.5f) * 2.0f * range;
+}
+
+#endif /* INC_DSP_PITCH_H_ */
@@ -0,0 +1,70 @@
+/**
+  ******************************************************************************
+  * @file    saturator.h
+  * @author  Bianchi Davide
+  * @brief   This file contains the tanh approximations used by the filter.
+  * 		 They are inline because they run once per sample per voice.
+  *
+  * 		 Maximum absolute error against tanh() on the whole real line:
+  * 		   SATURATOR_TANHF       libm reference
+  * 		   SATURATOR_RATIONAL    9.6e-5  Lambert [7/6], 1 division
+  * 		   SATURATOR_POLYNOMIAL  5.4e-3  odd minimax degree 9, clamped at 3
+  * 		   SATURATOR_TABLE       1.5e-4  256 intervals on [-5, 5], linear
+  *
+  * 		 The audio-quality threshold is 1e-3 (-60 dB): the default
+  * 		 (DEFAULT_SATURATOR) is below it. benchmarkSaturators() measures
+  * 		 the cycles and the error of every option on the target.
+  ******************************************************************************
+**/
+
+#include "parameters.h"
+#include "dsp/tables.h"
+
+#ifndef INC_DSP_SATURATOR_H_
+#define INC_DSP_SATURATOR_H_
+
+#define SATURATOR_RATIONAL_LIMIT	4.97f	// The [7/6] approximant reaches 1 here
+#define SATURATOR_POLY_LIMIT		3.0f
+
+/* ========== Exported functions ========== */
+static inline float clampf(float x, float limit) {
+	x = x > limit ? limit : x;
+	return x < -limit ? -limit : x;
+}
+
+static inline float saturateRational(float x) {
+	x = clampf(x, SATURATOR_RATIONAL_LIMIT);
+	float x2 = x * x;
+	float num = x * (135135.0f + x2 * (17325.0f + x2 * (378.0f + x2)));
+	float den = 135135.0f + x2 * (62370.0f + x2 * (3150.0f + x2 * 28.0f));
+	return num / den;
+}
+
+static inline float saturatePolynomial(float x) {
+	x = clampf(x, SATURATOR_POLY_LIMIT);
+	float x2 = x * x;
+	return x * (0.975852457f + x2 * (-0.253490182f + x2 * (0.0490945734f + x2 * (-0.00494654276f + x2 * 0.000193327683f))));
+}
+
+static inline float saturateTable(float x) {
+	float position = (clampf(x, TANH_TABLE_RANGE) + TANH_TABLE_RANGE) * (TANH_TABLE_SIZE / (2.0f * TANH_TABLE_RANGE));
+	int index = (int)position;
+	index = index < TANH_TABLE_SIZE ? index : TANH_TABLE_SIZE - 1;
+	float fraction = position - index;
+	return tanh_table[index] + fraction * (tanh_table[index + 1] - tanh_table[index]);
+}
+
+static inline float saturate(enum Saturator saturator, float x) {
+	switch (saturator) {
+		case SATURATOR_RATIONAL:
+			return saturateRational(x);
+		case SATURATOR_POLYNOMIAL:
+			return saturatePolynomial(x);
+		case SATURATOR_TABLE:
+			return saturateTable(x);
+		default:
+			return tanhf(x);
+	}
+}
+
+#endif /* INC_DSP_SATURATOR_H_ */
@@ -0,0 +1,35 @@
+/**
+  ******************************************************************************
+  * @file    smoother.h
+  * @author  Bianchi Davide
+  * @brief   This file contains all the prototypes for the smoother.c
+  ******************************************************************************
+**/
+
+#include "parameters.h"
+
+#ifndef INC_DSP_SMOOTHER_H_
+#define INC_DSP_SMOOTHER_H_
+
+/* ========== Base structure ========== */
+// Linear ramp of a parameter, advanced once per control block
+// Owned by the render: the fields are not written atomically, so an interrupt
+// must never set it (the pots arrive through audioDriverLatchAnalog())
+typedef struct {
+	float current;
+	float target;
+	float step;
+	int remaining;			// Steps left before the target
+	int ramp_steps;			// Length of a whole ramp
+	float inv_ramp_steps;
+} Smoother;
+
+/* ========== Exported functions ========== */
+void setupSmoother		(Smoother *smoother, float value, int ramp_steps);
+void setSmootherRamp	(Smoother *smoother, int ramp_steps);
+void setSmootherTarget	(Smoother *smoother, float target);
+void setSmootherValue	(Smoother *smoother, float value);
+float advanceSmoother	(Smoother *smoother);
+bool isSmootherActive	(Smoother *smoother);
+
+#endif /* INC_DSP_SMOOTHER_H_ */
@@ -12,27 +12,57 @@
 #include "dsp/mixer.h"
 #include "dsp/filter.h"
 #include "dsp/adsr.h"
+#include "dsp/voice.h"
+#include "dsp/smoother.h"
+#include "utils/profiler.h"
+#include "utils/memory_sections.h"
 
 #ifndef INC_DSP_SYNTHESIZER_H_
 #define INC_DSP_SYNTHESIZER_H_
 
 /* ========== Base structure ========== */
+// Continuous parameters ramped by the smoothers
+enum SmoothedParameter {
+	SMOOTH_GAIN_OSC1,
+	SMOOTH_GAIN_OSC2,
+	SMOOTH_DETUNE_OSC2,
+	SMOOTH_CUTOFF,
+	SMOOTH_RESONANCE,		// Pot value, see setFilterResonance()
+	SMOOTH_GAIN,
+	SMOOTH_MOD_WHEEL,
+	SMOOTH_COUNT
+};
+
+// Voices a MIDI route plays on (see setVoiceGroup()). The groups share the patch:
+// they split the polyphony between the inputs, not the sound
+typedef struct {
+	uint8_t first;
+	uint8_t count;
+} VoiceGroup;
+
+// Modulations evaluated once per control block and shared by all the voices
+typedef struct {
+	int block_size;			// Samples per control block
+	float inv_length;		// 1/length of the current control block
+	float pitch;			// Semitones added to every note (pitch bend and vibrato)
+	float cutoff;			// Filter cutoff reached at the end of the control block
+	float amplitude;		// Output multiplier (tremolo, gain and VOICE_MIX_GAIN), ramped
+	float amplitude_target;
+} Modulation;
+
 typedef struct {
 	// Main Components
 	Lfo lfo;
-	Osc osc1;
-	Osc osc2;
+	Voice voices[NUM_VOICES];
 	Mixer mixer;
-	Filter filter;
-	Adsr adsr;
+	Modulation modulation;
+	Smoother smoothers[SMOOTH_COUNT];	// Targets of the pots and CCs
 
-	// Buffers
-	float buffer_osc1[BUFFER_SIZE];
-	float buffer_osc2[BUFFER_SIZE];
-	float am_buffer[BUFFER_SIZE];
-	float fm_buffer_osc1[BUFFER_SIZE];
-	float fm_buffer_osc2[BUFFER_SIZE];
-	float fm_buffer_filter[BUFFER_SIZE];
+	// Scratch buffers of a control block
+	float buffer_osc1[MAX_CONTROL_BLOCK_SIZE];
+	float buffer_osc2[MAX_CONTROL_BLOCK_SIZE];
+	float mix_buffer[MAX_CONTROL_BLOCK_SIZE];
+	float oversampled_buffer[MAX_CONTROL_BLOCK_SIZE*OVERSAMPLING_MAX];
 
 	// Frequency and Slider value
 	float sr;
@@ -40,22 +70,41 @@ typedef struct {
 	float velocity;
 
 	// Modified by MIDI
-	float midi_note;
-	float hertz_note;
 	float mod_wheel;
 	float chn_vol;
 	float pan_ctrl;
 	float sustain_pedal;
-	int note_counter;
+
+	// Voice allocation
+	enum VoiceMode voice_mode;
+	enum NotePriority note_priority;
+	enum VoiceSteal voice_steal;
+	int voice_limit;						// Voices given to new notes (polyphony in use)
+	VoiceGroup groups[NUM_VOICE_GROUPS];
+	int8_t note_to_voice[NUM_VOICE_GROUPS][128];	// Voice playing every MIDI note of every group (NO_VOICE if none)
+	uint8_t note_stack[NOTE_STACK_SIZE];	// Held notes in the mono mode, oldest first
+	int note_stack_count;
+	uint32_t voice_age;						// Note-on counter
+
+	// Glide
+	enum GlideMode glide_mode;
+	float glide_time;		// Seconds
+	float glide_coeff;		// One-pole coefficient per control block
+	float last_note;		// Pitch of the last note played, where the next glide starts
 
 	// Pitch adjustment
 	float pitch_bend;
+	float bend_range;		// Semitones
+	uint8_t rpn_msb;		// Registered parameter selected by CC101/CC100
+	uint8_t rpn_lsb;
 	float detune_osc2;
 	float octave_osc1;
     float octave_osc2;
 
     // Filter cutoff
     float filter_cutoff;
+	enum Saturator saturator;
+	int oversampling;		// Factor of the filter
 
     // Mixer
     float gain_osc1;
@@ -74,19 +123,36 @@ typedef struct {
 /* ========== Exported functions ========== */
 // Constructor
 void setupSynthesizer(Synthesizer *synth, float sr);
+void setSynthSampleRate(Synthesizer *synth, float sr);
 // "Getters"
-void getFrequencyBuffers(Synthesizer *synth);
-void getSynthAudioBlock(Synthesizer *synth, int16_t *out_buffer);
+void getSynthAudioBlock(Synthesizer *synth, int16_t *out_buffer, int frames);
 // "Setters"
 void setOctaveOsc1(Synthesizer *synth, uint16_t new_value);
 void setOctaveOsc2(Synthesizer *synth, uint16_t new_value);
 void setDetuneOsc2(Synthesizer *synth, uint16_t new_value);
 void setFilterCutoff(Synthesizer *synth, uint16_t new_value);
 void setGain(Synthesizer *synth, uint16_t new_value);
-void applyGain(Synthesizer *synth, float *out_buffer);
+void setWaveformOsc1(Synthesizer *synth, int waveform);
+void setWaveformOsc2(Synthesizer *synth, int waveform);
+void setResonance(Synthesizer *synth, uint16_t new_value);
+void setSaturator(Synthesizer *synth, enum Saturator saturator);
+void setAttack(Synthesizer *synth, uint16_t new_value);
+void setDecay(Synthesizer *synth, uint16_t new_value);
+void setSustain(Synthesizer *synth, uint16_t new_value);
+void setRelease(Synthesizer *synth, uint16_t new_value);
+void setVoiceMode(Synthesizer *synth, enum VoiceMode voice_mode);
+void setNotePriority(Synthesizer *synth, enum NotePriority note_priority);
+void setBendRange(Synthesizer *synth, float semitones);
+void setGlideMode(Synthesizer *synth, enum GlideMode glide_mode);
+void setGlideTime(Synthesizer *synth, uint16_t new_value);
+void setControlBlockSize(Synthesizer *synth, int block_size);
+void setOversampling(Synthesizer *synth, int factor);
+void setVoiceLimit(Synthesizer *synth, int voice_limit);
+void setVoiceGroup(Synthesizer *synth, uint8_t group, int first, int count);
 // MIDI Parameters Functions
-void synthesizerNoteOn(Synthesizer *synth, float hertz_note, float velocity);
-void synthesizerNoteOff(Synthesizer *synth, float hertz_note, float velocity);
+void synthesizerNoteOn(Synthesizer *synth, uint8_t group, uint8_t midi_note, float velocity);
+void synthesizerNoteOff(Synthesizer *synth, uint8_t group, uint8_t midi_note, float velocity);
+void synthesizerAllNotesOff(Synthesizer *synth);
 void synthesizerControllerChange(Synthesizer *synth, uint8_t controller_id, float controller_value);
 void synthesizerPitchBend(Synthesizer *synth, float pitch_bend);
 // Parameters
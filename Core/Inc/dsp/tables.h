@@ -0,0 +1,47 @@
+/**
+  ******************************************************************************
+  * @file    tables.h
+  * @author  Bianchi Davide
+  * @brief   This file contains the declarations of the read-only tables
+  *          generated by Tools/generate_tables.py (tables.c)
+  ******************************************************************************
+**/
+
+#include "parameters.h"
+
+#ifndef INC_DSP_TABLES_H_
+#define INC_DSP_TABLES_H_
+
+/* ========== BLIT ========== */
+#define BLIT_TABLE_PHASES	256		// Sub-sample resolution of the impulses
+#define BLIT_TABLE_TAPS		16		// Length of every impulse (power of 2)
+
+/* ========== Saturator ========== */
+#define TANH_TABLE_SIZE		256		// Intervals, the table has one more guard point
+#define TANH_TABLE_RANGE	5.0f	// The table covers [-TANH_TABLE_RANGE, +TANH_TABLE_RANGE]
+
+/* ========== Filter ========== */
+#define FILTER_TABLE_SIZE		282		// Intervals, the table has one more guard row
+#define FILTER_TABLE_LOG2_MIN	-13.0f	// log2(cutoff/sample rate) of the first row
+#define FILTER_TABLE_STEPS		24		// Rows per octave, the last row is at fc/sr = 0.42
+#define FILTER_G				0		// Columns of a row
+#define FILTER_GLP				1
+#define FILTER_GTOT				2
+
+/* ========== LFO ========== */
+#define SINE_TABLE_SIZE			256		// Intervals, the table has one more guard point
+#define SINE_TABLE_BITS			8		// log2(SINE_TABLE_SIZE), top bits of the phase
+
+/* ========== Oversampler ========== */
+#define HALFBAND_1_TAPS			12		// Odd-phase taps of the first 2x stage (multiple of 4)
+#define HALFBAND_2_TAPS			4		// Odd-phase taps of the second 2x stage (multiple of 4)
+
+/* ========== Exported tables ========== */
+extern const float blit_table[BLIT_TABLE_PHASES][BLIT_TABLE_TAPS];
+extern const float tanh_table[TANH_TABLE_SIZE + 1];
+extern const float filter_table[FILTER_TABLE_SIZE + 1][3];
+extern const float sine_table[SINE_TABLE_SIZE + 1];
+extern const float halfband_1_table[HALFBAND_1_TAPS];
+extern const float halfband_2_table[HALFBAND_2_TAPS];
+
+#endif /* INC_DSP_TABLES_H_ */
@@ -0,0 +1,53 @@
+/**
+  ******************************************************************************
+  * @file    voice.h
+  * @author  Bianchi Davide
+  * @brief   This file contains all the prototypes for the voice.c
+  ******************************************************************************
+**/
+
+#include "parameters.h"
+#include "dsp/osc.h"
+#include "dsp/filter.h"
+#include "dsp/oversampler.h"
+#include "dsp/pitch.h"
+#include "dsp/adsr.h"
+
+#ifndef INC_DSP_VOICE_H_
+#define INC_DSP_VOICE_H_
+
+#define NO_VOICE		(-1)
+
+/* ========== Base structure ========== */
+typedef struct {
+	// Components of a single note
+	Osc osc1;
+	Osc osc2;
+	Filter filter;
+	Oversampler oversampler;	// Around the filter
+	Adsr adsr;
+
+	// Note played
+	uint8_t midi_note;
+	float note;			// Pitch in semitones (fractional MIDI note)
+	float target_note;	// Reached by the glide
+	float velocity;
+	uint32_t age;		// Note-on order, used to steal the oldest voice
+	uint8_t group;		// Voice group of the note (Synthesizer note_to_voice)
+	bool gate;			// Key held down
+	bool active;		// Sounding (gate or release)
+} Voice;
+
+/* ========== Exported functions ========== */
+void setupVoice			(Voice *voice, float sr);
+void setVoiceOversampling(Voice *voice, float sr, int factor);
+void setVoiceSampleRate	(Voice *voice, float sr);
+void voiceNoteOn		(Voice *voice, uint8_t midi_note, float velocity, uint32_t age);
+void voiceSetNote		(Voice *voice, uint8_t midi_note);
+void voiceGlideFrom		(Voice *voice, float note);
+void voiceGlide			(Voice *voice, float coeff);
+void voiceNoteOff		(Voice *voice);
+void voiceCheckEnd		(Voice *voice);
+float getVoiceLevel		(Voice *voice);
+
+#endif /* INC_DSP_VOICE_H_ */
@@ -19,6 +19,7 @@
 enum AdsrState {
     ADSR_IDLE,
     ADSR_ATTACK,
+    ADSR_DECAY,
     ADSR_SUSTAIN,
 	ADSR_RELEASE
 };
@@ -29,10 +30,73 @@ enum Waveform {
 	SQUARE
 };
 
-#define BUFFER_SIZE 	32		// I2S_BUFFER_SIZE/4
-#define I2S_BUFFER_SIZE 128
-#define SAMPLE_RATE		48828.0f
+// The first shapes match enum Waveform, so the LFO can stand in for an oscillator
+enum LfoWaveform {
+	LFO_TRIANGLE = TRIANGLE,
+	LFO_SAWTOOTH = SAWTOOTH,
+	LFO_SQUARE = SQUARE,
+	LFO_SINE,
+	LFO_SAMPLE_HOLD,
+	LFO_WAVEFORM_COUNT
+};
+
+enum Saturator {
+	SATURATOR_TANHF,
+	SATURATOR_RATIONAL,
+	SATURATOR_POLYNOMIAL,
+	SATURATOR_TABLE,
+	SATURATOR_COUNT
+};
+
+enum VoiceMode {
+	VOICE_MODE_POLY,
+	VOICE_MODE_MONO_LEGATO
+};
+
+enum NotePriority {
+	NOTE_PRIORITY_LAST,
+	NOTE_PRIORITY_LOW,
+	NOTE_PRIORITY_HIGH
+};
+
+enum GlideMode {
+	GLIDE_OFF,
+	GLIDE_LEGATO,		// Only from a note still held
+	GLIDE_ALWAYS
+};
+
+enum VoiceSteal {
+	VOICE_STEAL_OLDEST,
+	VOICE_STEAL_QUIETEST
+};
+
+// Nominal rates, the real one comes from the PLLI2S (see driver/audio_clock.h)
+enum SampleRate {
+	SAMPLE_RATE_32K 	= 32000,
+	SAMPLE_RATE_44K1 	= 44100,
+	SAMPLE_RATE_48K 	= 48000,
+	SAMPLE_RATE_96K 	= 96000
+};
+
+#define MIN_BUFFER_SIZE		16		// Stereo frames per half of the I2S buffer (the latency)
+#define MAX_BUFFER_SIZE		256
+#define DEFAULT_BUFFER_SIZE	32		// 0.67 ms at 48 kHz (48 frames are 1 ms)
+#define I2S_BUFFER_SIZE(frames)	((frames) * 4)	// Samples of the circular buffer: two halves of stereo frames
+#define DEFAULT_SAMPLE_RATE	SAMPLE_RATE_48K
+
+// Build options
+//#define SYNTH_BENCHMARK				// Run the dsp benchmarks at boot (see utils/benchmark.h)
+//#define SYNTH_PROFILER				// Cycles of every stage of the audio path (see utils/profiler.h)
+//#define SYNTH_KERNELS_IN_FLASH		// Keep the dsp kernels out of SRAM, to compare (see utils/memory_sections.h)
 
+//Valori parametri voci
+#define NUM_VOICES				4		// Polyphony (see benchmarkVoices() for the budget)
+#define VOICE_MIX_GAIN			(1.0f / NUM_VOICES)	// Headroom of the voice sum: all of them at full scale still fit
+#define NOTE_STACK_SIZE			16		// Held notes remembered by the mono mode
+#define NUM_VOICE_GROUPS		4		// Voice groups the MIDI routes play on (see setVoiceGroup()), all of the voices by default
+#define DEFAULT_VOICE_MODE		VOICE_MODE_POLY
+#define DEFAULT_NOTE_PRIORITY	NOTE_PRIORITY_LAST
+#define DEFAULT_VOICE_STEAL		VOICE_STEAL_OLDEST
 //Valori parametri oscillatori
 #define DEFAULT_MUTE_OSC_1      false	// Osc1 not muted
 #define DEFAULT_MUTE_OSC_2      true    // Osc2 muted
@@ -40,7 +104,7 @@ enum Waveform {
 #define DEFAULT_OCTAVE	    	1
 #define DEFAULT_DETUNE          0.0f
 #define DEFAULT_GAIN	        0.3f
-#define DEFAULT_HERTZ_NOTE		220.0f
+#define DEFAULT_NOTE			57		// A3, 220 Hz
 //Valori parametri LFO
 #define DEFAULT_WF_LFO		    0
 #define DEFAULT_RATE_LFO        3.0f
@@ -49,9 +113,14 @@ enum Waveform {
 #define DEFAULT_CUTOFF_RATE     10000.0
 #define MAX_CUTOFF_RATE         20000.0
 #define DEFAULT_RESONANCE       0.2f
+#define DEFAULT_SATURATOR		SATURATOR_TABLE		// 1.5e-4 of error, below 1e-3 (cycles of every option in benchmarkSaturators())
+#define OVERSAMPLING_MAX		4		// 1, 2 or 4: largest factor the oversampler reserves memory for
+#define DEFAULT_OVERSAMPLING	1		// Runtime factor of the filter (see benchmarkOversampling())
 //Valori parametri Loudness + Filter ADSR
-#define DEFAULT_ATTACK          0.0001f
-#define DEFAULT_RELEASE			0.0001f
+#define DEFAULT_ATTACK          0		// Pot values [0, 4095], times from the table in adsr.c
+#define DEFAULT_DECAY			2048
+#define DEFAULT_SUSTAIN			4095	// Full level: attack and release only
+#define DEFAULT_RELEASE			0
 //Valori parametri Enabler Generici
 #define DEFAULT_OSC_MODULATION      false
 #define DEFAULT_FILTER_MODULATION   false
@@ -60,10 +129,32 @@ enum Waveform {
 #define DEFAULT_MODULATION_WHEEL    0.0f
 #define DEFAULT_MAX_MOD_AMOUNT      0.999f
 #define DEFAULT_MIN_MOD_AMOUNT      0.001f
+#define DEFAULT_CONTROL_BLOCK_SIZE  8		// Samples between two updates of the modulations
+#define DEFAULT_SMOOTHING_TIME      0.02f	// Seconds of the ramp of a pot or CC change
+#define MAX_CONTROL_BLOCK_SIZE      32		// Length of the voice scratch buffers
 //Valori parametri Controlli Generici
-#define DEFAULT_GLIDE_RATE		    0.001f
+#define NUM_ADC_CHANNELS			11		// Pots converted by ADC1 in a scan (MX_ADC1_Init()), latched by the audio driver
+#define DEFAULT_GLIDE_MODE		    GLIDE_OFF
+#define DEFAULT_GLIDE_TIME		    0.1f	// Seconds to get within GLIDE_EPSILON of the note
+#define GLIDE_MIN_TIME				0.005f	// Pot/CC5 range
+#define GLIDE_MAX_TIME				5.0f
+#define GLIDE_EPSILON				0.01f	// Semitones: the glide is over this close to the note
 #define DEFAULT_PITCH_WHEEL         0.5f
+#define DEFAULT_BEND_RANGE			12.0f	// Semitones at full pitch wheel (RPN 0)
+#define DEFAULT_VIBRATO_RANGE		2.0f	// Semitones at full modulation wheel
 #define DEFAULT_VELOCITY			1.0f
+//Valori parametri governor (see utils/governor.h)
+#define DEFAULT_GOVERNOR			true
+#define GOVERNOR_MAX_LOAD			0.9f	// Render cycles/half-buffer period that steps the quality down
+#define GOVERNOR_MIN_LOAD			0.5f	// Below it for GOVERNOR_UP_TIME the quality steps back up
+#define GOVERNOR_DOWN_TIME			0.05f	// Seconds between two steps down
+#define GOVERNOR_UP_TIME			2.0f	// Seconds of headroom before a step up
+#define GOVERNOR_SATURATOR			SATURATOR_POLYNOMIAL	// 5.4e-3 of error, arithmetic only: no division nor table load
+//Valori parametri MIDI (see utils/midi_decoder.h)
+#define DEFAULT_MIDI_CABLES			0xFFFF	// Bit n: USB-MIDI virtual cable n accepted
+#define DEFAULT_MIDI_CHANNELS		0xFFFF	// Bit n: channel n+1 accepted, all of them is omni
+#define DEFAULT_MIDI_GROUP			0		// Voice group of every cable and channel (see setMidiRoute())
+#define DEFAULT_MIDI_PLAYOUT_DELAY	2.0f	// ms added to the USB events: one frame spread back plus the decode, 0 plays them at once
 
 #endif /* INC_PARAMETERS_H_ */
 
@@ -0,0 +1,60 @@
+/**
+  ******************************************************************************
+  * @file    benchmark.h
+  * @author  Bianchi Davide
+  * @brief   This file contains all the prototypes for the benchmark.c
+  *          The benchmarks are compiled only with SYNTH_BENCHMARK (parameters.h)
+  *          and their results are read with the debugger in benchmark_results.
+  ******************************************************************************
+**/
+
+#include "parameters.h"
+#include "utils/cycle_counter.h"
+
+#ifndef INC_UTILS_BENCHMARK_H_
+#define INC_UTILS_BENCHMARK_H_
+
+#define BENCHMARK_BLOCKS	500		// Blocks of DEFAULT_BUFFER_SIZE rendered by every measure
+#define BENCHMARK_CONTROL_SIZES	6		// Control blocks of 1, 2, 4, 8, 16 and 32 samples
+#define BENCHMARK_BUFFER_SIZES	5		// Half buffers of 16, 32, 64, 128 and 256 frames
+
+/* ========== Base structure ========== */
+typedef struct {
+	// Oscillator, cycles per sample for every waveform (TRIANGLE, SAWTOOTH, SQUARE)
+	float blit_sample_cycles[3];	// getBlitSample() called once per sample
+	float blit_block_cycles[3];		// getBlitAudioBlock() called once per block
+
+	// Voices, cycles per block of DEFAULT_BUFFER_SIZE spent in getSynthAudioBlock()
+	float synth_idle_cycles;		// No voice sounding
+	float voice_cycles;				// Added by every sounding voice
+	float block_budget_cycles;		// Core cycles between two half-buffer interrupts
+	float max_voices;				// Voices that fit in the budget at DEFAULT_SAMPLE_RATE
+
+	// Filter saturators (enum Saturator), all the voices sounding
+	float saturator_block_cycles[SATURATOR_COUNT];	// Cycles per getSynthAudioBlock()
+	float saturator_max_error[SATURATOR_COUNT];		// Max abs error against tanhf() on [-8, 8]
+
+	// Control rate, all the voices sounding with every modulation on
+	float control_block_cycles[BENCHMARK_CONTROL_SIZES];	// Cycles per getSynthAudioBlock()
+	float control_saving_cycles;	// Saved by DEFAULT_CONTROL_BLOCK_SIZE against per-sample updates
+
+	// Filter oversampling (factor 1, 2, 4), all the voices sounding
+	float oversampling_voice_cycles[3];	// Cycles per block added by every voice
+	float oversampling_max_voices[3];	// Voices that fit in the budget
+
+	// Latency (MIN_BUFFER_SIZE to MAX_BUFFER_SIZE), all the voices sounding
+	float buffer_frame_cycles[BENCHMARK_BUFFER_SIZES];	// Cycles per frame of getSynthAudioBlock()
+} BenchmarkResults;
+
+extern volatile BenchmarkResults benchmark_results;
+
+/* ========== Exported functions ========== */
+void runBenchmarks	(void);
+void benchmarkBlit	(void);
+void benchmarkVoices(void);
+void benchmarkSaturators(void);
+void benchmarkControlRate(void);
+void benchmarkOversampling(void);
+void benchmarkBufferSizes(void);
+
+#endif /* INC_UTILS_BENCHMARK_H_ */
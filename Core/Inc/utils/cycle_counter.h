@@ -0,0 +1,26 @@
+/**
+  ******************************************************************************
+  * @file    cycle_counter.h
+  * @author  Bianchi Davide
+  * @brief   This file contains the inline helpers around the DWT cycle counter
+  *          of the Cortex-M4 (one tick = one core clock cycle)
+  ******************************************************************************
+**/
+
+#include "stm32f4xx_hal.h"
+
+#ifndef INC_UTILS_CYCLE_COUNTER_H_
+#define INC_UTILS_CYCLE_COUNTER_H_
+
+/* ========== Exported functions ========== */
+static inline void cycleCounterInit(void) {
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;	// Enable the trace block (DWT)
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static inline uint32_t cycleCounterGet(void) {
+	return DWT->CYCCNT;
+}
+
+#endif /* INC_UTILS_CYCLE_COUNTER_H_ */
@@ -0,0 +1,43 @@
+/**
+  ******************************************************************************
+  * @file    event_queue.h
+  * @author  Bianchi Davide
+  * @brief   This file contains all the prototypes for the event_queue.c
+  *          Single-producer/single-consumer ring of timestamped MIDI events:
+  *          the main loop pushes the decoded messages, the audio render pops
+  *          them at the start of every half buffer (see audioDriverRender()).
+  *          No lock: head is written by the producer only, tail by the
+  *          consumer only, and an event is complete before head publishes it.
+  ******************************************************************************
+**/
+
+#include "parameters.h"
+
+#ifndef INC_UTILS_EVENT_QUEUE_H_
+#define INC_UTILS_EVENT_QUEUE_H_
+
+#define EVENT_QUEUE_SIZE	64		// Power of 2, a full USB transfer is 16 events
+
+/* ========== Base structure ========== */
+typedef struct {
+	uint32_t time;			// Cycle counter at the arrival
+	uint8_t status;			// MIDI status byte
+	uint8_t data_byte_1;
+	uint8_t data_byte_2;
+	uint8_t group;			// Voice group of the route (see setMidiRoute())
+} SynthEvent;
+
+typedef struct {
+	SynthEvent events[EVENT_QUEUE_SIZE];
+	volatile uint32_t head;			// Free running, next write
+	volatile uint32_t tail;			// Free running, next read
+	volatile uint32_t overflows;	// Events dropped on a full queue, read with the debugger
+} EventQueue;
+
+/* ========== Exported functions ========== */
+void setupEventQueue(EventQueue *queue);
+bool pushEvent		(EventQueue *queue, uint32_t time, uint8_t status, uint8_t data_byte_1, uint8_t data_byte_2, uint8_t group);
+SynthEvent *peekEvent(EventQueue *queue);
+void popEvent		(EventQueue *queue);
+
+#endif /* INC_UTILS_EVENT_QUEUE_H_ */
@@ -0,0 +1,35 @@
+/**
+  ******************************************************************************
+  * @file    fast_math.h
+  * @author  Bianchi Davide
+  * @brief   This file contains the inline approximations of the libm functions
+  *          used at control rate, where the libm ones are too slow
+  ******************************************************************************
+**/
+
+#include <stdint.h>
+
+#ifndef INC_UTILS_FAST_MATH_H_
+#define INC_UTILS_FAST_MATH_H_
+
+/* ========== Exported functions ========== */
+// log2(x) for x > 0, max abs error 1.9e-4 (0.23 cents)
+static inline float fastLog2f(float x) {
+	union { float f; uint32_t i; } v = { x };
+	float exponent = (float)((int32_t)((v.i >> 23) & 0xFF) - 127);
+	v.i = (v.i & 0x007FFFFF) | 0x3F800000;	// Mantissa in [1, 2)
+	float t = v.f - 1.0f;
+	return exponent + t * (1.43854679f + t * (-0.678081486f + t * (0.323630368f + t * -0.0842850926f)));
+}
+
+// 2^x for x in [-126, 127], max relative error 4.6e-6 (0.008 cents)
+static inline float fastExp2f(float x) {
+	int32_t exponent = (int32_t)x;
+	exponent -= (x < (float)exponent);		// Floor
+	float t = x - (float)exponent;			// [0, 1)
+	union { float f; uint32_t i; } v = { 1.0f + t * (0.693018631f + t * (0.241404768f + t * (0.0520739356f + t * 0.0134934755f))) };
+	v.i += (uint32_t)exponent << 23;
+	return v.f;
+}
+
+#endif /* INC_UTILS_FAST_MATH_H_ */
@@ -0,0 +1,57 @@
+/**
+  ******************************************************************************
+  * @file    governor.h
+  * @author  Bianchi Davide
+  * @brief   This file contains all the prototypes for the governor.c
+  *
+  *          The governor trades quality for cycles when a block gets close to
+  *          its deadline. Every level keeps the previous ones, the least
+  *          audible first:
+  *            1  filter oversampling off
+  *            2  GOVERNOR_SATURATOR in the filter
+  *            3  control blocks of MAX_CONTROL_BLOCK_SIZE
+  *            4  half of the voices
+  *            5  one voice
+  *          A setting the user changes while the quality is down wins: it is
+  *          kept as the one to restore, and the lower levels start from it.
+  *          It runs in the render context, after every block.
+  ******************************************************************************
+**/
+
+#include "parameters.h"
+#include "dsp/synthesizer.h"
+
+#ifndef INC_UTILS_GOVERNOR_H_
+#define INC_UTILS_GOVERNOR_H_
+
+#define GOVERNOR_LEVELS		5
+
+/* ========== Base structure ========== */
+typedef struct {
+	bool enabled;
+	int level;					// 0 is full quality
+
+	// Settings of level 0, saved when the governor leaves it and restored on return
+	int oversampling;
+	enum Saturator saturator;
+	int control_block_size;
+	int voice_limit;
+
+	// Settings of the synth after the last step: one that differs was changed by the user
+	int applied_oversampling;
+	enum Saturator applied_saturator;
+	int applied_control_block_size;
+	int applied_voice_limit;
+
+	float timer;				// Seconds since the last step, or of headroom
+	volatile float load;		// Last block, read with the debugger
+	volatile uint32_t steps_down;
+	volatile uint32_t steps_up;
+} Governor;
+
+/* ========== Exported functions ========== */
+void setupGovernor	(Governor *governor);
+void setGovernorEnabled(Governor *governor, Synthesizer *synth, bool enabled);
+void updateGovernor	(Governor *governor, Synthesizer *synth, float load, bool underrun, float block_time);
+
+#endif /* INC_UTILS_GOVERNOR_H_ */
@@ -0,0 +1,31 @@
+/**
+  ******************************************************************************
+  * @file    memory_sections.h
+  * @author  Bianchi Davide
+  * @brief   This file contains the placement attributes of the hot audio path
+  *          (see STM32F407VGTX_FLASH.ld and Tools/map_report.py).
+  *
+  *          CCM_DATA  state in the 64K CCM RAM, on the D-bus only: the render
+  *                    never waits for the DMA streams on the SRAM matrix.
+  *                    The DMA cannot reach it: no I2S/ADC/USB buffer here.
+  *                    Zeroed at boot like .bss.
+  *          RAM_FUNC  kernels copied to SRAM with .data and fetched with no
+  *                    flash wait states (the ART cache holds only 1K).
+  *                    The calls from flash go through the veneers of the linker.
+  ******************************************************************************
+**/
+
+#include "parameters.h"
+
+#ifndef INC_UTILS_MEMORY_SECTIONS_H_
+#define INC_UTILS_MEMORY_SECTIONS_H_
+
+#define CCM_DATA	__attribute__((section(".ccmbss")))
+
+#ifdef SYNTH_KERNELS_IN_FLASH
+#define RAM_FUNC
+#else
+#define RAM_FUNC	__attribute__((section(".RamFunc")))
+#endif
+
+#endif /* INC_UTILS_MEMORY_SECTIONS_H_ */
@@ -3,6 +3,42 @@
   * @file    midi_decoder.h
   * @author  Bianchi Davide
   * @brief   This file contains all the prototypes for the midi_decoder.c
+  *          midiDecode() runs in the main loop and only queues the messages,
+  *          midiApplyEvent() runs in the audio render and plays them.
+  *
+  *          The USB-MIDI packets are read in place and dispatched on their
+  *          Code Index Number (CIN, low nibble of the header byte):
+  *            0x2-0x3  system common        ignored
+  *            0x4-0x7  SysEx                reassembled, midiSysExCallback()
+  *            0x8-0xE  channel messages     filtered on cable and channel, routed, queued
+  *            0xF      single byte          real time on the fast path
+  *          Aftertouch and program change are recognized but have no
+  *          destination in the synth yet.
+  *
+  *          Every input (parser), cable and channel is routed to a voice
+  *          group of the synth (setMidiRoute(), setVoiceGroup()): a keyboard,
+  *          a controller and a sequencer can split the polyphony. The notes
+  *          follow the route, the controllers act on the whole patch.
+  *
+  *          USB delivers the messages one frame (1 ms) at a time: a transfer is
+  *          stamped with the SOF of its frame and its packets are spread back
+  *          over the frame before it, at even steps. They are then played a
+  *          fixed playout delay later, so that a fast arpeggio keeps its
+  *          spacing instead of collapsing on the USB frames and the audio
+  *          blocks (see setMidiPlayoutDelay()).
+  *
+  *          The device is set with its own SysEx, F0 7D <command> <data> F7
+  *          (7D is the non-commercial ID), handled by midiSysExCallback() in
+  *          main.c. The values are 7-bit bytes, MSB first:
+  *            0x01  frames MSB, LSB     audio buffer size (requestAudioBufferSize())
+  *            0x02  Hz, 3 bytes         sample rate, one of enum SampleRate (requestAudioSampleRate())
+  *            0x03  source, cable,      route of an input (enum MidiSource), cable
+  *                  channel, group      and channel (1 to 16) (setMidiRoute())
+  *            0x04  group, first, count voices of a group, queued for the render (setVoiceGroup())
+  *
+  *          The DIN input (driver/midi_uart.h) is a byte stream: midiDecodeByte()
+  *          rebuilds the messages (running status) and sends them through the
+  *          same table. Its SysEx is skipped, it would end in an interrupt.
   ******************************************************************************
 **/
 
@@ -10,24 +46,77 @@
 #include "usbh_core.h"
 #include "dsp/synthesizer.h"
 #include "driver/usbh_midi.h"
+#include "utils/event_queue.h"
+#include "utils/cycle_counter.h"
 
 #ifndef INC_DRIVER_MIDI_DRIVER_H_
 #define INC_DRIVER_MIDI_DRIVER_H_
 
-static float hertz_notes[88] = 	{
-									27.50, 29.14, 30.87, 32.70, 34.65, 36.71, 38.89, 41.20, 43.65, 46.25, 49.00, 51.91, 						// ottava 1
-									55.00, 58.27, 61.74, 65.41, 69.30, 73.42, 77.78, 82.41, 87.31, 92.50, 98.00, 103.83, 						// ottava 2
-									110.00, 116.54, 123.47, 130.81, 138.59, 146.83, 155.56, 164.81, 174.61, 185.00, 196.00, 207.65, 			// ottava 3
-									220.00, 233.08, 246.94, 261.63, 277.18, 293.66, 311.13, 329.63, 349.23, 369.99, 392.00, 415.30, 			// ottava 4
-									440.00, 466.16, 493.88, 523.25, 554.37, 587.33, 622.25, 659.25, 698.46, 739.99, 783.99, 830.61, 			// ottava 5
-									880.00, 932.33, 987.77, 1046.50, 1108.73, 1174.66, 1244.51, 1318.51, 1396.91, 1479.98, 1567.98, 1661.22, 	// ottava 6
-									1760.00, 1864.66, 1975.53, 2093.00, 2217.46, 2349.32, 2489.02, 2637.02, 2793.83, 2959.96, 3135.96, 3322.44, // ottava 7
-									3520.00, 3729.31, 3951.07, 4186.01, 4434.92, 4698.63, 4978.03, 5274.04, 5587.65, 5919.91, 6271.93, 6644.88  // ottava 8
-								};
+#define MIDI_PACKET_SIZE	4		// Header (cable, CIN) and up to 3 MIDI bytes
+#define MIDI_SYSEX_SIZE		128		// Longest SysEx reassembled (F0 to F7), longer ones are dropped
+#define MIDI_USB_FRAME_RATE	1000	// Full speed SOF, Hz
+
+// Device SysEx (see above)
+#define MIDI_SYSEX_ID			0x7D	// Non-commercial manufacturer ID
+#define MIDI_SYSEX_HEADER		3		// F0, ID and command, the data follows
+#define MIDI_SYSEX_BUFFER_SIZE	0x01
+#define MIDI_SYSEX_SAMPLE_RATE	0x02
+#define MIDI_SYSEX_ROUTE		0x03
+#define MIDI_SYSEX_VOICE_GROUP	0x04
+#define MIDI_EVENT_VOICE_GROUP	0xF4	// Undefined system common, never sent: queued by MIDI_SYSEX_VOICE_GROUP
+
+// MIDI inputs, each one with its parser and its event queue
+enum MidiSource {
+	MIDI_SOURCE_USB,
+	MIDI_SOURCE_DIN,
+	MIDI_SOURCE_COUNT
+};
+
+/* ========== Base structure ========== */
+typedef struct {
+	// Filters
+	uint16_t cable_mask;			// Bit n: virtual cable n accepted
+	uint16_t channel_mask;			// Bit n: channel n+1 accepted
+	uint8_t routes[16][16];			// Voice group of every cable and channel
+
+	// SysEx being reassembled, one at a time
+	uint8_t sysex[MIDI_SYSEX_SIZE];
+	uint16_t sysex_length;			// 0 outside of a SysEx
+	bool sysex_overflow;			// Too long, dropped at its end
+
+	// Timing of the USB transfers (midiDecode())
+	uint32_t frame_cycles;			// Core cycles of a USB frame
+	uint32_t playout_cycles;		// Added to every packet time
+	uint32_t last_time;				// SOF of the last transfer, its packets end there
+
+	// Message being rebuilt from a byte stream (midiDecodeByte())
+	uint8_t running_status;			// 0 when none
+	uint8_t data_count;
+	uint8_t data[2];
+
+	// Real time, read with the debugger or by the main loop
+	volatile uint32_t clock_ticks;	// Timing clocks since the last Start, 24 per quarter note
+	volatile uint32_t clock_time;	// Cycle counter at the last timing clock
+	volatile bool running;			// Start/Continue, Stop
+	volatile uint32_t sensing_time;	// Cycle counter at the last active sensing
+
+	// Statistics, read with the debugger
+	volatile uint32_t packets;		// USB packets or stream messages
+	volatile uint32_t filtered;		// Other cables or channels
+	volatile uint32_t dropped_sysex;
+} MidiParser;
+
 /* ========== Exported functions ========== */
-void midiDecode(USBH_HandleTypeDef *phost, Synthesizer *synth, uint8_t *midi_rx_buffer);
-void midiDecodeNoteOff(Synthesizer *synth, uint8_t data_byte_1, uint8_t data_byte_2);
-void midiDecodeNoteOn(Synthesizer *synth, uint8_t data_byte_1, uint8_t data_byte_2);
+void setupMidiParser(MidiParser *parser);
+void setMidiFilter	(MidiParser *parser, uint16_t cable_mask, uint16_t channel_mask);
+void setMidiPlayoutDelay(MidiParser *parser, float delay_ms);
+void setMidiRoute	(MidiParser *parser, uint8_t cable, uint8_t channel, uint8_t group);
+void midiDecode		(MidiParser *parser, EventQueue *queue, const uint8_t *buffer, uint16_t length, uint32_t time);
+void midiDecodeByte	(MidiParser *parser, EventQueue *queue, uint8_t byte, uint32_t time);
+void midiApplyEvent	(Synthesizer *synth, SynthEvent *event);
+void midiSysExCallback(MidiParser *parser, EventQueue *queue, const uint8_t *sysex, uint16_t length, uint32_t time);
+void midiDecodeNoteOff(Synthesizer *synth, uint8_t group, uint8_t data_byte_1, uint8_t data_byte_2);
+void midiDecodeNoteOn(Synthesizer *synth, uint8_t group, uint8_t data_byte_1, uint8_t data_byte_2);
 void midiDecodeControllerChange(Synthesizer *synth, uint8_t data_byte_1, uint8_t data_byte_2);
 void midiDecodePitchBend(Synthesizer *synth, uint8_t data_byte_1, uint8_t data_byte_2);
 
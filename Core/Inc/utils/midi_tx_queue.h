@@ -0,0 +1,38 @@
+/**
+  ******************************************************************************
+  * @file    midi_tx_queue.h
+  * @author  Bianchi Davide
+  * @brief   This file contains all the prototypes for the midi_tx_queue.c
+  *          Multi-producer/single-consumer ring of USB-MIDI packets (4 bytes,
+  *          one word): any context (main loop, audio render, interrupts) can
+  *          push, the USB host class pops them in the main loop and packs
+  *          them in the bulk OUT transfers.
+  *          No lock: a producer reserves its slot with LDREX/STREX on head
+  *          and publishes it by writing the packet, never 0 since the Code
+  *          Index Number is never 0. The consumer stops at the first slot
+  *          not written yet and clears the ones it takes.
+  ******************************************************************************
+**/
+
+#include "parameters.h"
+
+#ifndef INC_UTILS_MIDI_TX_QUEUE_H_
+#define INC_UTILS_MIDI_TX_QUEUE_H_
+
+#define MIDI_TX_QUEUE_SIZE	64		// Power of 2, 4 full USB transfers
+
+/* ========== Base structure ========== */
+typedef struct {
+	volatile uint32_t packets[MIDI_TX_QUEUE_SIZE];	// Bytes in wire order (little endian), 0 while free
+	volatile uint32_t head;			// Free running, next slot to reserve
+	volatile uint32_t tail;			// Free running, next read
+	volatile uint32_t overflows;	// Packets refused on a full queue, read with the debugger
+} MidiTxQueue;
+
+/* ========== Exported functions ========== */
+void setupMidiTxQueue(MidiTxQueue *queue);
+bool pushMidiPacket	(MidiTxQueue *queue, uint8_t cable, uint8_t status, uint8_t data_byte_1, uint8_t data_byte_2);
+uint32_t getMidiTxSpace(MidiTxQueue *queue);
+uint16_t popMidiPackets(MidiTxQueue *queue, uint8_t *buffer, uint16_t size);
+
+#endif /* INC_UTILS_MIDI_TX_QUEUE_H_ */
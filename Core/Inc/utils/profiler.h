@@ -0,0 +1,92 @@
+/**
+  ******************************************************************************
+  * @file    profiler.h
+  * @author  Bianchi Davide
+  * @brief   This file contains all the prototypes for the profiler.c
+  *          The profiler is compiled only with SYNTH_PROFILER (parameters.h):
+  *          without it the PROFILE_ macros are empty and cost nothing.
+  *
+  *          The audio path is the only writer. The cycles of every stage are
+  *          summed over the getSynthAudioBlock() calls of a half buffer (one,
+  *          or one per MIDI event) and committed by the audio driver, under
+  *          a sequence counter: readProfiler() copies a consistent snapshot
+  *          without masking the interrupts, resetProfiler() only raises a flag
+  *          that the audio path serves at the next block.
+  ******************************************************************************
+**/
+
+#include "parameters.h"
+#include "utils/cycle_counter.h"
+
+#ifndef INC_UTILS_PROFILER_H_
+#define INC_UTILS_PROFILER_H_
+
+// Stages of getSynthAudioBlock(), the cycles are per block (all the voices)
+enum ProfilerStage {
+	PROFILE_MODULATION,		// LFO, smoothers and modulations of the control blocks
+	PROFILE_OSC,			// Oscillators and their mix
+	PROFILE_FILTER,			// Filter, with the oversampler
+	PROFILE_ENVELOPE,		// ADSR and sum into the mix
+	PROFILE_OUTPUT,			// Gain ramp and int16 conversion
+	PROFILE_BLOCK,			// Whole getSynthAudioBlock() calls
+	PROFILE_STAGE_COUNT
+};
+
+#ifdef SYNTH_PROFILER
+
+/* ========== Base structure ========== */
+typedef struct {
+	uint32_t min;
+	uint32_t max;
+	uint64_t total;
+} ProfilerStat;
+
+typedef struct {
+	volatile uint32_t sequence;		// Odd while the audio path commits a block
+	volatile bool reset_request;
+	float cycles_per_frame;			// Core cycles in a sample period
+
+	uint32_t running[PROFILE_STAGE_COUNT];	// Sums of the block being rendered
+	ProfilerStat stats[PROFILE_STAGE_COUNT];
+	uint32_t blocks;
+	uint64_t frames;
+	float load;						// Percent of the half-buffer period, last block
+	float max_load;
+} Profiler;
+
+// Snapshot returned by readProfiler()
+typedef struct {
+	float min_cycles[PROFILE_STAGE_COUNT];
+	float max_cycles[PROFILE_STAGE_COUNT];
+	float mean_cycles[PROFILE_STAGE_COUNT];
+	uint32_t blocks;
+	float load;
+	float max_load;
+	float mean_load;
+} ProfilerReport;
+
+extern Profiler profiler;
+
+/* ========== Exported functions ========== */
+void setupProfiler	(float sr);
+void resetProfiler	(void);
+void readProfiler	(ProfilerReport *report);
+void profilerEndBlock(int frames);
+
+static inline void profilerAdd(enum ProfilerStage stage, uint32_t cycles) {
+	profiler.running[stage] += cycles;
+}
+
+#define PROFILE_TIME()					cycleCounterGet()
+#define PROFILE_ADD(stage, start)		profilerAdd((stage), cycleCounterGet() - (start))
+#define PROFILE_END_BLOCK(frames)		profilerEndBlock(frames)
+
+#else
+
+#define PROFILE_TIME()					0
+#define PROFILE_ADD(stage, start)		((void)(start))
+#define PROFILE_END_BLOCK(frames)		((void)(frames))
+
+#endif /* SYNTH_PROFILER */
+
+#endif /* INC_UTILS_PROFILER_H_ */
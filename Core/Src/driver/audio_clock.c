@@ -0,0 +1,62 @@
+/**
+  ******************************************************************************
+  * @file    audio_clock.c
+  * @author  Bianchi Davide
+  * @brief   This file contains the sample rate configuration of I2S3.
+  *          The PLLI2S and the I2S prescaler are written directly: a new
+  *          HAL_I2S_Init() would run the MSP again and restore the PLLI2S
+  *          of the CubeMX configuration.
+  ******************************************************************************
+**/
+
+#include "driver/audio_clock.h"
+
+/* ========== Search ========== */
+// Every PLLI2SN/PLLI2SR pair with the nearest divider, returns the real rate
+float findAudioClock(AudioClock *clock, float rate, float vco_input) {
+	float best_error = rate;
+
+	for(uint32_t n = PLLI2S_N_MIN; n <= PLLI2S_N_MAX; n++) {
+		float vco = vco_input * n;
+		if(vco < PLLI2S_VCO_MIN || vco > PLLI2S_VCO_MAX) {
+			continue;
+		}
+		for(uint32_t r = PLLI2S_R_MIN; r <= PLLI2S_R_MAX; r++) {
+			float i2s_clock = vco / r;
+			int divider = (int)(i2s_clock / (256.0f * rate) + 0.5f);
+			if(divider < I2S_DIVIDER_MIN || divider > I2S_DIVIDER_MAX) {
+				continue;
+			}
+			float real_rate = i2s_clock / (256.0f * divider);
+			float error = fabsf(real_rate - rate);
+			if(error < best_error) {
+				best_error 		= error;
+				clock->plli2sn 	= n;
+				clock->plli2sr 	= r;
+				clock->divider 	= divider;
+				clock->rate 	= real_rate;
+			}
+		}
+	}
+	return clock->rate;
+}
+
+/* ========== Hardware ========== */
+// The I2S must be stopped (no DMA running), it is left disabled
+float setAudioClock(I2S_HandleTypeDef *hi2s, AudioClock *clock, float rate) {
+	uint32_t pllm = (RCC->PLLCFGR & RCC_PLLCFGR_PLLM) >> RCC_PLLCFGR_PLLM_Pos;
+	findAudioClock(clock, rate, (float)HSE_VALUE / pllm);
+
+	__HAL_I2S_DISABLE(hi2s);
+
+	RCC_PeriphCLKInitTypeDef periph_clock = {0};
+	periph_clock.PeriphClockSelection 	= RCC_PERIPHCLK_I2S;
+	periph_clock.PLLI2S.PLLI2SN 		= clock->plli2sn;
+	periph_clock.PLLI2S.PLLI2SR 		= clock->plli2sr;
+	if(HAL_RCCEx_PeriphCLKConfig(&periph_clock) != HAL_OK) {
+		Error_Handler();
+	}
+
+	hi2s->Instance->I2SPR = (clock->divider >> 1) | ((clock->divider & 1) << SPI_I2SPR_ODD_Pos) | SPI_I2SPR_MCKOE;
+	return clock->rate;
+}
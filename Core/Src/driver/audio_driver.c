@@ -0,0 +1,274 @@
+/**
+  ******************************************************************************
+  * @file    audio_driver.c
+  * @author  Bianchi Davide
+  * @brief   This file contains the deferred rendering of the I2S buffer:
+  * 		 the DMA interrupt hands the free half to PendSV, that renders it
+  * 		 at the lowest priority so USB, MIDI and the controls can preempt it.
+  *
+  * 		 The deadline of a half is the next half-buffer interrupt, when the
+  * 		 DMA starts reading it again. The slack is measured from the
+  * 		 interrupt, so it includes the time PendSV waited to run.
+  ******************************************************************************
+**/
+
+#include "driver/audio_driver.h"
+
+/* ========== Private functions ========== */
+static void setAudioSampleRate(AudioDriver *driver, enum SampleRate rate);
+static void setAudioBufferSize(AudioDriver *driver, int frames);
+static int clampBufferSize(int frames);
+static bool isDmaReading(AudioDriver *driver, int16_t *block);
+static void renderHalf(AudioDriver *driver, int16_t *block, uint32_t event_time);
+static void applyControls(AudioDriver *driver);
+static int getEventOffset(AudioDriver *driver, uint32_t time, uint32_t event_time);
+static SynthEvent *peekNextEvent(AudioDriver *driver, int *source);
+
+/* ========== Constructor ========== */
+// The I2S must be initialized and stopped
+void setupAudioDriver(AudioDriver *driver, Synthesizer *synth, I2S_HandleTypeDef *hi2s, int16_t *buffer, enum SampleRate rate) {
+	driver->synth 	= synth;
+	driver->hi2s 	= hi2s;
+	driver->buffer 	= buffer;
+	driver->pending = NULL;
+	driver->event_time = 0;
+	driver->adc_pending  = false;
+	driver->pins_pending = 0;
+	setupGovernor(&driver->governor);
+	for(int s = 0; s < MIDI_SOURCE_COUNT; s++) {
+		setupEventQueue(&driver->events[s]);
+	}
+
+	cycleCounterInit();
+	setAudioSampleRate(driver, rate);
+	setAudioBufferSize(driver, DEFAULT_BUFFER_SIZE);
+	driver->requested_rate 	 = driver->rate;
+	driver->requested_frames = driver->frames;
+}
+
+void startAudioDriver(AudioDriver *driver) {
+	HAL_I2S_Transmit_DMA(driver->hi2s, (uint16_t *)driver->buffer, driver->length);
+}
+
+/* ========== Buffer size and sample rate ========== */
+// Safe from any context, the DMA is re-armed later by audioDriverProcess()
+void requestAudioBufferSize(AudioDriver *driver, int frames) {
+	driver->requested_frames = clampBufferSize(frames);
+}
+
+// Lower rates leave more cycles per sample (more voices) for less bandwidth
+void requestAudioSampleRate(AudioDriver *driver, enum SampleRate rate) {
+	driver->requested_rate = rate;
+}
+
+// Called by the main loop: PendSV preempts it, so no half is being rendered here
+void audioDriverProcess(AudioDriver *driver) {
+	if(driver->requested_frames == driver->frames && driver->requested_rate == driver->rate) {
+		return;
+	}
+
+	HAL_I2S_DMAStop(driver->hi2s);
+	__disable_irq();
+	driver->pending = NULL;		// A half marked before the stop
+	__enable_irq();
+
+	if(driver->requested_rate != driver->rate) {
+		setAudioSampleRate(driver, driver->requested_rate);
+	}
+	setAudioBufferSize(driver, driver->requested_frames);
+	startAudioDriver(driver);
+}
+
+/* ========== Interrupt side ========== */
+// Called by the I2S DMA callbacks: half is 0 after the half transfer, 1 after the full one
+void audioDriverHalfDone(AudioDriver *driver, int half) {
+	driver->event_time = cycleCounterGet();
+	if(driver->pending != NULL) {
+		driver->dropped_blocks++;	// The previous half was never started, it plays stale samples
+	}
+	driver->pending = &driver->buffer[half * (driver->length / 2)];
+	SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+}
+
+// Called by HAL_ADC_ConvCpltCallback(): a whole scan of the pots, copied before the DMA writes the next one
+void audioDriverLatchAnalog(AudioDriver *driver, const uint16_t *adc_values) {
+	for(int c = 0; c < NUM_ADC_CHANNELS; c++) {
+		driver->adc_values[c] = adc_values[c];
+	}
+	driver->adc_pending = true;
+}
+
+// Called by HAL_GPIO_EXTI_Callback(): the pin is read again by the render, only the line is kept
+void audioDriverLatchDigital(AudioDriver *driver, uint16_t pin) {
+	driver->pins_pending |= pin;	// Same priority for all the EXTI lines, no other writer preempts it
+}
+
+/* ========== Render context ========== */
+// Called by PendSV_Handler()
+void audioDriverRender(AudioDriver *driver) {
+	__disable_irq();
+	int16_t *block 		= driver->pending;
+	uint32_t event_time = driver->event_time;
+	driver->pending 	= NULL;
+	__enable_irq();
+
+	if(block == NULL) {
+		return;
+	}
+
+	uint32_t start = cycleCounterGet();
+	renderHalf(driver, block, event_time);
+	uint32_t end = cycleCounterGet();
+	PROFILE_END_BLOCK(driver->frames);
+	bool underrun = isDmaReading(driver, block);
+
+	// Unsigned differences survive the wrap of the cycle counter
+	int32_t slack = (int32_t)driver->period_cycles - (int32_t)(end - event_time);
+	driver->render_cycles = end - start;
+	driver->slack_cycles = slack;
+	if(driver->render_cycles > driver->max_render_cycles) {
+		driver->max_render_cycles = driver->render_cycles;
+	}
+	if(slack < driver->min_slack_cycles) {
+		driver->min_slack_cycles = slack;
+	}
+	if(underrun) {
+		driver->underruns++;
+	}
+	driver->blocks++;
+
+	float load = (float)driver->render_cycles / driver->period_cycles;
+	updateGovernor(&driver->governor, driver->synth, load, underrun, driver->frames / driver->sr);
+}
+
+/* ========== Utils ========== */
+void resetAudioDriverStats(AudioDriver *driver) {
+	driver->render_cycles 		= 0;
+	driver->max_render_cycles 	= 0;
+	driver->slack_cycles 		= (int32_t)driver->period_cycles;
+	driver->min_slack_cycles 	= (int32_t)driver->period_cycles;
+	driver->blocks 				= 0;
+	driver->underruns 			= 0;
+	driver->dropped_blocks 		= 0;
+	for(int s = 0; s < MIDI_SOURCE_COUNT; s++) {
+		driver->event_latency_cycles[s] 	= 0;
+		driver->max_event_latency_cycles[s] = 0;
+	}
+}
+
+/* ========== Private functions ========== */
+// The DMA must be stopped. The dsp gets the real rate, so the tuning is exact
+static void setAudioSampleRate(AudioDriver *driver, enum SampleRate rate) {
+	driver->rate = rate;
+	driver->sr = setAudioClock(driver->hi2s, &driver->clock, rate);
+	setSynthSampleRate(driver->synth, driver->sr);
+#ifdef SYNTH_PROFILER
+	setupProfiler(driver->sr);
+#endif
+}
+
+// The DMA must be stopped
+static void setAudioBufferSize(AudioDriver *driver, int frames) {
+	driver->frames = clampBufferSize(frames);
+	driver->length = I2S_BUFFER_SIZE(driver->frames);
+	driver->period_cycles = (uint32_t)((float)SystemCoreClock * driver->frames / driver->sr);
+	memset(driver->buffer, 0, driver->length * sizeof(int16_t));	// The first halves play silence
+	resetAudioDriverStats(driver);
+}
+
+static int clampBufferSize(int frames) {
+	frames = frames < MIN_BUFFER_SIZE ? MIN_BUFFER_SIZE : frames;
+	return frames > MAX_BUFFER_SIZE ? MAX_BUFFER_SIZE : frames;
+}
+
+// Renders the half in segments, split at the sample offset of every event of the last period
+static void renderHalf(AudioDriver *driver, int16_t *block, uint32_t event_time) {
+	SynthEvent *event;
+	int source;
+	int done = 0;
+
+	applyControls(driver);
+
+	while((event = peekNextEvent(driver, &source)) != NULL) {
+		int offset = getEventOffset(driver, event->time, event_time);
+		if(offset < 0) {
+			break;		// Arrived after the interrupt: it belongs to the next half
+		}
+		if(offset > done) {
+			getSynthAudioBlock(driver->synth, &block[done * 2], offset - done);
+			done = offset;
+		}
+		midiApplyEvent(driver->synth, event);
+
+		// From the arrival (plus the USB playout delay) to the synth, the half then waits for the DMA (up to two periods)
+		uint32_t latency = cycleCounterGet() - event->time;
+		driver->event_latency_cycles[source] = latency;
+		if(latency > driver->max_event_latency_cycles[source]) {
+			driver->max_event_latency_cycles[source] = latency;
+		}
+		popEvent(&driver->events[source]);
+	}
+	if(done < driver->frames) {
+		getSynthAudioBlock(driver->synth, &block[done * 2], driver->frames - done);
+	}
+}
+
+// Pots and switches latched since the last half, applied between two blocks
+static void applyControls(AudioDriver *driver) {
+	uint16_t adc_values[NUM_ADC_CHANNELS];
+
+	__disable_irq();				// A consistent scan: the ADC interrupt may be copying the next one
+	bool analog = driver->adc_pending;
+	if(analog) {
+		for(int c = 0; c < NUM_ADC_CHANNELS; c++) {
+			adc_values[c] = driver->adc_values[c];
+		}
+	}
+	uint16_t pins = driver->pins_pending;
+	driver->adc_pending  = false;
+	driver->pins_pending = 0;
+	__enable_irq();
+
+	if(analog) {
+		parametersChangedAnalog(driver->synth, adc_values);
+	}
+	for(uint16_t pin = 1; pins != 0; pin <<= 1) {
+		if(pins & pin) {
+			parametersChangedDigital(driver->synth, pin);
+			pins &= ~pin;
+		}
+	}
+}
+
+// Frame of the half where the event plays: its position in the period that ended at the interrupt.
+// 0 for a late event (older than the period), -1 for an event of the next half
+static int getEventOffset(AudioDriver *driver, uint32_t time, uint32_t event_time) {
+	int32_t age = (int32_t)(event_time - time);		// Unsigned difference, survives the wrap
+	if(age < 0) {
+		return -1;
+	}
+	if(age >= (int32_t)driver->period_cycles) {
+		return 0;
+	}
+	return (int)((float)(driver->period_cycles - age) * driver->frames / driver->period_cycles);
+}
+
+// Oldest of the events at the head of the queues, NULL when they are all empty
+static SynthEvent *peekNextEvent(AudioDriver *driver, int *source) {
+	SynthEvent *next = NULL;
+	for(int s = 0; s < MIDI_SOURCE_COUNT; s++) {
+		SynthEvent *event = peekEvent(&driver->events[s]);
+		if(event != NULL && (next == NULL || (int32_t)(event->time - next->time) < 0)) {
+			next 	= event;
+			*source = s;
+		}
+	}
+	return next;
+}
+
+// NDTR counts the samples left in the DMA cycle: the block is late if the DMA is already inside it
+static bool isDmaReading(AudioDriver *driver, int16_t *block) {
+	uint16_t position = driver->length - __HAL_DMA_GET_COUNTER(driver->hi2s->hdmatx);
+	uint16_t block_start = block - driver->buffer;
+	return position >= block_start && position < block_start + driver->length / 2;
+}
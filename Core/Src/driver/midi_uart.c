@@ -0,0 +1,90 @@
+/**
+  ******************************************************************************
+  * @file    midi_uart.c
+  * @author  Bianchi Davide
+  * @brief   This file contains the DIN MIDI input. USART2 and its DMA stream
+  * 		 are written directly: the HAL UART module is not in the project.
+  ******************************************************************************
+**/
+
+#include "driver/midi_uart.h"
+
+/* ========== Private functions ========== */
+static void readMidiUart(MidiUart *uart, uint32_t end_time);
+
+/* ========== Constructor ========== */
+// PA2/PA3 are already in AF7 (MX_GPIO_Init()), only the reception is used
+void setupMidiUart(MidiUart *uart, EventQueue *queue) {
+	uart->usart 		= USART2;
+	uart->dma 			= DMA1_Stream5;
+	uart->queue 		= queue;
+	uart->position 		= 0;
+	uart->byte_cycles 	= SystemCoreClock / MIDI_BAUD_RATE * MIDI_BYTE_BITS;
+	uart->bytes 		= 0;
+	uart->line_errors 	= 0;
+	setupMidiParser(&uart->parser);
+
+	__HAL_RCC_USART2_CLK_ENABLE();
+	__HAL_RCC_DMA1_CLK_ENABLE();
+
+	// DMA: USART2_RX is the channel 4 of DMA1_Stream5, bytes into a circular buffer
+	uart->dma->CR &= ~DMA_SxCR_EN;
+	while(uart->dma->CR & DMA_SxCR_EN);
+	DMA1->HIFCR = DMA_HIFCR_CTCIF5 | DMA_HIFCR_CHTIF5 | DMA_HIFCR_CTEIF5 | DMA_HIFCR_CDMEIF5 | DMA_HIFCR_CFEIF5;
+	uart->dma->PAR 	= (uint32_t)&uart->usart->DR;
+	uart->dma->M0AR = (uint32_t)uart->buffer;
+	uart->dma->NDTR = MIDI_UART_BUFFER_SIZE;
+	uart->dma->FCR 	= 0;			// Direct mode
+	uart->dma->CR 	= DMA_CHANNEL_4 | DMA_PRIORITY_MEDIUM | DMA_PERIPH_TO_MEMORY | DMA_SxCR_MINC | DMA_SxCR_CIRC | DMA_SxCR_HTIE | DMA_SxCR_TCIE;
+	uart->dma->CR  |= DMA_SxCR_EN;
+
+	// USART: 8N1, 16x oversampling, the received bytes go to the DMA, the errors and the idle line interrupt
+	uart->usart->CR1 = 0;
+	uart->usart->BRR = (HAL_RCC_GetPCLK1Freq() + MIDI_BAUD_RATE / 2) / MIDI_BAUD_RATE;
+	uart->usart->CR2 = 0;
+	uart->usart->CR3 = USART_CR3_DMAR | USART_CR3_EIE;
+	uart->usart->CR1 = USART_CR1_UE | USART_CR1_RE | USART_CR1_IDLEIE;
+
+	HAL_NVIC_SetPriority(USART2_IRQn, MIDI_UART_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(USART2_IRQn);
+	HAL_NVIC_SetPriority(DMA1_Stream5_IRQn, MIDI_UART_PRIORITY, 0);
+	HAL_NVIC_EnableIRQ(DMA1_Stream5_IRQn);
+}
+
+/* ========== Interrupt side ========== */
+// Called by USART2_IRQHandler(): idle line after a burst, or a line error
+void midiUartIrq(MidiUart *uart) {
+	uint32_t now = cycleCounterGet();
+	uint32_t status = uart->usart->SR;
+	(void)uart->usart->DR;			// After the read of SR, clears IDLE, ORE, NE and FE
+
+	if(status & (USART_SR_FE | USART_SR_NE | USART_SR_ORE)) {
+		uart->line_errors++;
+	}
+	if(status & USART_SR_IDLE) {
+		readMidiUart(uart, now - uart->byte_cycles);	// The line has been idle for a byte
+	}
+}
+
+// Called by DMA1_Stream5_IRQHandler(): half or whole buffer written during a long burst
+void midiUartDmaIrq(MidiUart *uart) {
+	uint32_t now = cycleCounterGet();
+	DMA1->HIFCR = DMA_HIFCR_CTCIF5 | DMA_HIFCR_CHTIF5;
+	readMidiUart(uart, now);
+}
+
+/* ========== Private functions ========== */
+// Parses the bytes written by the DMA since the last call. Within a burst they come
+// back to back, so each one is stamped a byte time before the next
+static void readMidiUart(MidiUart *uart, uint32_t end_time) {
+	uint16_t head = (MIDI_UART_BUFFER_SIZE - uart->dma->NDTR) % MIDI_UART_BUFFER_SIZE;
+	uint16_t count = (head - uart->position + MIDI_UART_BUFFER_SIZE) % MIDI_UART_BUFFER_SIZE;
+	uint32_t time = end_time - (count - 1) * uart->byte_cycles;
+
+	while(uart->position != head) {
+		midiDecodeByte(&uart->parser, uart->queue, uart->buffer[uart->position], time);
+		time += uart->byte_cycles;
+		uart->position = (uart->position + 1) % MIDI_UART_BUFFER_SIZE;
+	}
+	uart->bytes += count;
+}
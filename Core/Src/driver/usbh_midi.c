@@ -9,6 +9,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "driver/usbh_midi.h"
+#include "utils/cycle_counter.h"
 
 /*------------------------------------------------------------------------------------------------------------------------------*/
 
@@ -23,6 +24,7 @@
     static USBH_StatusTypeDef USBH_MIDI_ClassRequest(USBH_HandleTypeDef *phost);
     static void MIDI_ProcessTransmission(USBH_HandleTypeDef *phost);
     static void MIDI_ProcessReception(USBH_HandleTypeDef *phost);
+    static void MIDI_SubmitReception(USBH_HandleTypeDef *phost, MIDI_HandleTypeDef *MIDI_Handle);
 
     USBH_ClassTypeDef  MIDI_Class =
     {
@@ -225,7 +227,7 @@ static USBH_StatusTypeDef USBH_MIDI_Process(USBH_HandleTypeDef *phost)
         break;
 
         case MIDI_TRANSFER_DATA:
-            //MIDI_ProcessTransmission(phost);
+            MIDI_ProcessTransmission(phost);
             MIDI_ProcessReception(phost);
         break;
 
@@ -248,14 +250,20 @@ static USBH_StatusTypeDef USBH_MIDI_Process(USBH_HandleTypeDef *phost)
 
 /**
   * @brief  USBH_MIDI_SOFProcess
-  *         The function is for managing SOF callback (Start of frame: used for synchronization)
+  *         The function is for managing SOF callback (Start of frame: used for synchronization).
+  *         Called by the OTG_FS interrupt every 1 ms, after phost->Timer (the frame number) is incremented:
+  *         the cycle counter of the SOF is the time reference of the transfers of the frame
   * @param  phost: Host handle
   * @retval USBH Status
   */
 static USBH_StatusTypeDef USBH_MIDI_SOFProcess(USBH_HandleTypeDef *phost)
 {
-    /* Prevent unused argument(s) compilation warning */
-    UNUSED(phost);
+    MIDI_HandleTypeDef *MIDI_Handle = (MIDI_HandleTypeDef *) phost->pActiveClass->pData;
+
+    if (MIDI_Handle != NULL)
+    {
+        MIDI_Handle->SofTime = cycleCounterGet();
+    }
     return USBH_OK;
 }
 
@@ -273,6 +281,7 @@ USBH_StatusTypeDef USBH_MIDI_Stop(USBH_HandleTypeDef *phost)
     if (phost->gState == HOST_CLASS)    // called in the USBH_Process in usbh_core.c
     {
         MIDI_Handle->state = MIDI_IDLE_STATE;
+        MIDI_Handle->data_rx_state = MIDI_IDLE;                         // The interrupt ignores the halt of the input pipe
         (void)USBH_ClosePipe(phost, MIDI_Handle->DataItf.InPipe);       // Close the input pipe
         (void)USBH_ClosePipe(phost, MIDI_Handle->DataItf.OutPipe);      // Close the output pipe
     }
@@ -281,7 +290,8 @@ USBH_StatusTypeDef USBH_MIDI_Stop(USBH_HandleTypeDef *phost)
 
 /**
   * @brief  USBH_MIDI_GetLastReceivedDataSize
-            This function return last received data size
+            This function return the size of the buffer being delivered to USBH_MIDI_ReceiveCallback()
+            (the pipe itself may already be in the middle of the next transfer)
   * @param  None
   * @retval None
   */
@@ -292,7 +302,7 @@ uint16_t USBH_MIDI_GetLastReceivedDataSize(USBH_HandleTypeDef *phost)
 
     if (phost->gState == HOST_CLASS)
     {
-        dataSize = USBH_LL_GetLastXferSize(phost, MIDI_Handle->DataItf.InPipe);
+        dataSize = MIDI_Handle->RxLength[MIDI_Handle->RxRead];
     }
     else
     {
@@ -313,7 +323,8 @@ USBH_StatusTypeDef USBH_MIDI_Transmit(USBH_HandleTypeDef *phost, uint8_t *pbuff,
     USBH_StatusTypeDef Status = USBH_BUSY;
     MIDI_HandleTypeDef *MIDI_Handle = (MIDI_HandleTypeDef *) phost->pActiveClass->pData;
 
-    if ((MIDI_Handle->state == MIDI_IDLE_STATE) || (MIDI_Handle->state == MIDI_TRANSFER_DATA))
+    if (((MIDI_Handle->state == MIDI_IDLE_STATE) || (MIDI_Handle->state == MIDI_TRANSFER_DATA)) &&
+        (MIDI_Handle->data_tx_state == MIDI_IDLE))  // Not over a transfer in flight
     {
         MIDI_Handle->pTxData = pbuff;
         MIDI_Handle->TxDataLength = length;
@@ -325,9 +336,31 @@ USBH_StatusTypeDef USBH_MIDI_Transmit(USBH_HandleTypeDef *phost, uint8_t *pbuff,
 }
 
 
+/**
+  * @brief  USBH_MIDI_TransmitQueue
+  *         This function attaches the queue of the packets to send, once: from then on every
+  *         transfer takes all the packets queued while the previous one was in flight
+  * @param  None
+  * @retval None
+  */
+USBH_StatusTypeDef USBH_MIDI_TransmitQueue(USBH_HandleTypeDef *phost, MidiTxQueue *queue)
+{
+    USBH_StatusTypeDef Status = USBH_BUSY;
+    MIDI_HandleTypeDef *MIDI_Handle = (MIDI_HandleTypeDef *) phost->pActiveClass->pData;
+
+    if ((MIDI_Handle->state == MIDI_IDLE_STATE) || (MIDI_Handle->state == MIDI_TRANSFER_DATA))
+    {
+        MIDI_Handle->pTxQueue = queue;
+        MIDI_Handle->state = MIDI_TRANSFER_DATA;
+        Status = USBH_OK;
+    }
+    return Status;
+}
+
 /**
   * @brief  USBH_MIDI_Receive
-  *         This function prepares the state before issuing the class specific commands
+  *         This function starts the reception, once: pbuff holds USBH_MIDI_RX_BUFFERS buffers of
+  *         length bytes (at least the endpoint size), then the transfers are re-armed by the interrupt
   * @param  None
   * @retval None
   */
@@ -336,9 +369,20 @@ USBH_StatusTypeDef USBH_MIDI_Receive(USBH_HandleTypeDef *phost, uint8_t *pbuff,
     USBH_StatusTypeDef Status = USBH_BUSY;
     MIDI_HandleTypeDef *MIDI_Handle = (MIDI_HandleTypeDef *) phost->pActiveClass->pData;
 
+    if (MIDI_Handle->data_rx_state != MIDI_IDLE)                  // Already running, it would drop the buffers not delivered yet
+    {
+        return Status;
+    }
+
     if ((MIDI_Handle->state == MIDI_IDLE_STATE) || (MIDI_Handle->state == MIDI_TRANSFER_DATA))
     {
-        MIDI_Handle->pRxData = pbuff;
+        for (uint8_t i = 0U; i < USBH_MIDI_RX_BUFFERS; i++)
+        {
+            MIDI_Handle->pRxBuffer[i] = pbuff + i * length;
+            MIDI_Handle->RxLength[i] = 0U;
+        }
+        MIDI_Handle->RxFill = 0U;
+        MIDI_Handle->RxRead = 0U;
         MIDI_Handle->RxDataLength = length;
         MIDI_Handle->state = MIDI_TRANSFER_DATA;
         MIDI_Handle->data_rx_state = MIDI_RECEIVE_DATA;
@@ -360,6 +404,23 @@ static void MIDI_ProcessTransmission(USBH_HandleTypeDef *phost)
 
     switch (MIDI_Handle->data_tx_state)
     {
+        case MIDI_IDLE:
+            if (MIDI_Handle->pTxQueue == NULL)
+            {
+                break;
+            }
+
+            MIDI_Handle->TxDataLength = popMidiPackets(MIDI_Handle->pTxQueue,
+                                                       MIDI_Handle->TxBuffer,
+                                                       MIN(MIDI_Handle->DataItf.OutEpSize, USBH_MIDI_TX_TRANSFER));   // One transfer, no waiting for more packets
+            if (MIDI_Handle->TxDataLength == 0U)
+            {
+                break;
+            }
+            MIDI_Handle->pTxData = MIDI_Handle->TxBuffer;
+            MIDI_Handle->data_tx_state = MIDI_SEND_DATA;
+        /* fall through */
+
         case MIDI_SEND_DATA:
             if (MIDI_Handle->TxDataLength > MIDI_Handle->DataItf.OutEpSize) // Data to be transmitted is too big for the endpoint (it must be trasmitted in more packet)
             {
@@ -423,62 +484,104 @@ static void MIDI_ProcessTransmission(USBH_HandleTypeDef *phost)
 
 /**
   * @brief  MIDI_ProcessReception
-  *         This function responsible for reception of data from the device
+  *         This function delivers the buffers received by the interrupt (USBH_MIDI_NotifyURBChange()),
+  *         from the main loop. It submits a transfer only for the first one, or when both buffers were
+  *         still full at the end of the previous one
   * @param  pdev: Selected device
   * @retval None
   */
 static void MIDI_ProcessReception(USBH_HandleTypeDef *phost)
 {
     MIDI_HandleTypeDef *MIDI_Handle = (MIDI_HandleTypeDef *) phost->pActiveClass->pData;
-    USBH_URBStateTypeDef URB_Status = USBH_URB_IDLE;
-    uint32_t length;
-    //MIDI_Handle->data_rx_state = MIDI_RECEIVE_DATA_WAIT;
-/*
-    USBH_StatusTypeDef status = USBH_InterruptReceiveData(phost,
-                        MIDI_Handle->pRxData,           // Pointer to data to be received
-                        MIDI_Handle->DataItf.InEpSize,  // The size of the ep is always the maximum
-                        MIDI_Handle->DataItf.InPipe);   // Number of the pipe used for communication
-  */
+    uint8_t read;
 
-    switch (MIDI_Handle->data_rx_state)
+    while (MIDI_Handle->RxLength[MIDI_Handle->RxRead] != 0U)   // Completed buffers, in order of arrival
     {
-        case MIDI_RECEIVE_DATA:
+        read = MIDI_Handle->RxRead;
+        USBH_MIDI_ReceiveCallback(phost, MIDI_Handle->pRxBuffer[read], MIDI_Handle->RxLength[read], MIDI_Handle->RxTime[read]);
+        __DMB();                                    // The buffer is decoded before the interrupt can fill it again
+        MIDI_Handle->RxLength[read] = 0U;
+        MIDI_Handle->RxRead = read ^ 1U;
+    }
 
-            (void)USBH_BulkReceiveData(phost,
-                                       MIDI_Handle->pRxData,           // Pointer to data to be received
-                                       MIDI_Handle->DataItf.InEpSize,  // The size of the ep is always the maximum
-                                       MIDI_Handle->DataItf.InPipe);   // Number of the pipe used for communication
+    if (MIDI_Handle->data_rx_state == MIDI_RECEIVE_DATA)       // No transfer in flight, so no interrupt can change the state here
+    {
+        MIDI_SubmitReception(phost, MIDI_Handle);
+    }
+}
 
-            MIDI_Handle->data_rx_state = MIDI_RECEIVE_DATA_WAIT;        // After receiving the packet of data, turn into wait stage
+/**
+  * @brief  MIDI_SubmitReception
+  *         The function submits a bulk IN transfer in the buffer RxFill
+  * @param  pdev: Selected device
+  * @retval None
+  */
+static void MIDI_SubmitReception(USBH_HandleTypeDef *phost, MIDI_HandleTypeDef *MIDI_Handle)
+{
+    MIDI_Handle->data_rx_state = MIDI_RECEIVE_DATA_WAIT;        // Before the submission: the transfer can end before it returns
 
-        break;
+    (void)USBH_BulkReceiveData(phost,
+                               MIDI_Handle->pRxBuffer[MIDI_Handle->RxFill],   // Pointer to data to be received
+                               MIDI_Handle->DataItf.InEpSize,                 // The size of the ep is always the maximum
+                               MIDI_Handle->DataItf.InPipe);                  // Number of the pipe used for communication
+}
 
-        case MIDI_RECEIVE_DATA_WAIT:
+/**
+  * @brief  USBH_MIDI_NotifyURBChange
+  *         Called by the OTG_FS interrupt (HAL_HCD_HC_NotifyURBChange_Callback()) at every URB state change.
+  *         A completed reception is stamped with its frame and left to the main loop, the next one is submitted at once
+  *         in the other buffer. The NAKs (USBH_URB_NOTREADY) are retried by the HAL itself
+  * @param  phost: Host handle
+  * @param  pipe: pipe (host channel) of the URB
+  * @param  urb_state: new state of the URB
+  * @retval None
+  */
+void USBH_MIDI_NotifyURBChange(USBH_HandleTypeDef *phost, uint8_t pipe, USBH_URBStateTypeDef urb_state)
+{
+    MIDI_HandleTypeDef *MIDI_Handle;
+    uint32_t length;
+    uint8_t fill;
 
-            URB_Status = USBH_LL_GetURBState(phost, MIDI_Handle->DataItf.InPipe);   // Checking the state of the reception
+    if ((phost->gState != HOST_CLASS) || (phost->pActiveClass != &MIDI_Class) || (phost->pActiveClass->pData == NULL))
+    {
+        return;                                     // Enumeration, or the class is being released by the main loop
+    }
 
-            /*Check the status done for reception*/
+    MIDI_Handle = (MIDI_HandleTypeDef *) phost->pActiveClass->pData;
+    if ((pipe != MIDI_Handle->DataItf.InPipe) || (MIDI_Handle->data_rx_state != MIDI_RECEIVE_DATA_WAIT))
+    {
+        return;                                     // Transmission, or a pipe halted by USBH_MIDI_Stop()
+    }
 
-            if (URB_Status == USBH_URB_DONE)    // Block of data received with success
+    switch (urb_state)
+    {
+        case USBH_URB_DONE:
+            fill = MIDI_Handle->RxFill;
+            length = USBH_LL_GetLastXferSize(phost, MIDI_Handle->DataItf.InPipe);
+            if (length != 0U)                       // A zero length packet carries no event, its buffer is reused
             {
+                MIDI_Handle->RxTime[fill] = MIDI_Handle->SofTime;     // Not the end of the transfer: where the poll ends in the frame is jitter
+                MIDI_Handle->RxFrame[fill] = phost->Timer;
+                __DMB();                            // The data and the time are written before the main loop can see the length
+                MIDI_Handle->RxLength[fill] = (uint16_t)length;
+                fill ^= 1U;
+                MIDI_Handle->RxFill = fill;
+            }
 
-                length = USBH_LL_GetLastXferSize(phost, MIDI_Handle->DataItf.InPipe);   // Getting the size of the last block of bytes received
-
-                if (((MIDI_Handle->RxDataLength - length) > 0U) && (length > MIDI_Handle->DataItf.InEpSize))    // If length of the data trasmitted is less than the total data and the length of the data is more than the total size
-                {
-                    MIDI_Handle->RxDataLength -= length;                // Calculate the length of the remaining part to be received
-                    MIDI_Handle->pRxData += length;                     // Pointer to the data received
-                    MIDI_Handle->data_rx_state = MIDI_RECEIVE_DATA;     // The reception must continue because more bytes need to be sent by the device
-                }
-
-                else // This means the last packet of bytes received was the last of the sequence
-                {
-                    MIDI_Handle->data_rx_state = MIDI_IDLE; // Return to the idle state
-                    USBH_MIDI_ReceiveCallback(phost);       // to be implemented
-                }
+            if (MIDI_Handle->RxLength[fill] == 0U)
+            {
+                MIDI_SubmitReception(phost, MIDI_Handle);
+            }
+            else                                    // The main loop is still decoding: it submits after the release
+            {
+                MIDI_Handle->RxStalls++;
+                MIDI_Handle->data_rx_state = MIDI_RECEIVE_DATA;
             }
         break;
 
+        case USBH_URB_ERROR:                        // Three transaction errors in a row, submitted again by the main loop
+            MIDI_Handle->data_rx_state = MIDI_RECEIVE_DATA;
+        break;
 
         default:
         break;
@@ -499,14 +602,21 @@ __weak void USBH_MIDI_TransmitCallback(USBH_HandleTypeDef *phost)
 
 /**
   * @brief  USBH_MIDI_ReceiveCallback
-  *         The function informs user that data have been sent
+  *         The function informs user that data have been received, from the main loop.
+  *         The buffer is released on return, the next transfer may already be in flight
   * @param  pdev: Selected device
+  * @param  pbuff: received data
+  * @param  length: bytes received
+  * @param  time: cycle counter at the SOF of the frame of the transfer
   * @retval None
   */
-__weak void USBH_MIDI_ReceiveCallback(USBH_HandleTypeDef *phost)
+__weak void USBH_MIDI_ReceiveCallback(USBH_HandleTypeDef *phost, uint8_t *pbuff, uint16_t length, uint32_t time)
 {
     /* Prevent unused argument(s) compilation warning */
     UNUSED(phost);
+    UNUSED(pbuff);
+    UNUSED(length);
+    UNUSED(time);
 }
 
 /**
@@ -3,70 +3,152 @@
   * @file    adsr.c
   * @author  Bianchi Davide
   * @brief   This file contains the whole structure and function of the adsr.
+  * 	     Every segment is a one-pole towards its target, that gets within
+  * 	     ADSR_EPSILON of it after the time set by the pot. The coefficients
+  * 	     come from a table shared by all the envelopes, built once for the
+  * 	     sample rate.
   ******************************************************************************
 **/
 
 #include "dsp/adsr.h"
 
+// One-pole coefficient for every pot position (times from ADSR_MIN_TIME to ADSR_MAX_TIME)
+static float adsr_coeff_table[ADSR_TABLE_SIZE];
+static float adsr_table_sr = 0.0f;
+
+/* ========== Private functions ========== */
+static void buildAdsrTable(float sr);
+static float getAdsrCoeff(float pot_value);
+
 /* ========== Constructor ========== */
 void setupAdsr(Adsr *adsr, float sr) {
+	if(adsr_table_sr != sr) {
+		buildAdsrTable(sr);
+	}
 	adsr->sr = sr;
-	adsr->attack = DEFAULT_ATTACK;
-	adsr->release = DEFAULT_RELEASE;
-	adsr->sample_value = 0.0f;
-	adsr->step = 0.0f;
 	adsr->env = 0.0f;
 	adsr->reset_voice = 0;
 	adsr->state = ADSR_IDLE;
+	setAdsrAttack(adsr, DEFAULT_ATTACK);
+	setAdsrDecay(adsr, DEFAULT_DECAY);
+	setAdsrSustain(adsr, DEFAULT_SUSTAIN);
+	setAdsrRelease(adsr, DEFAULT_RELEASE);
 }
 
 /* ========== Setters ========== */
+// The table is rebuilt by the first envelope at the new rate, the segment in progress keeps its level
+void setAdsrSampleRate(Adsr *adsr, float sr) {
+	if(adsr_table_sr != sr) {
+		buildAdsrTable(sr);
+	}
+	adsr->sr = sr;
+	setAdsrAttack(adsr, adsr->attack);
+	setAdsrDecay(adsr, adsr->decay);
+	setAdsrRelease(adsr, adsr->release);
+}
+// Pot values [0, 4095]
 void setAdsrAttack(Adsr *adsr, float attack) {
-	adsr->attack = attack * 0.000244f + DEFAULT_ATTACK;
+	adsr->attack = attack;
+	adsr->attack_coeff = getAdsrCoeff(attack);
+}
+void setAdsrDecay(Adsr *adsr, float decay) {
+	adsr->decay = decay;
+	adsr->decay_coeff = getAdsrCoeff(decay);
+}
+void setAdsrSustain(Adsr *adsr, float sustain) {
+	adsr->sustain = sustain * 0.000244f;	// [0, 1]
+	if(adsr->state == ADSR_SUSTAIN) {
+		adsr->state = ADSR_DECAY;			// Glide to the new level
+	}
 }
 void setAdsrRelease(Adsr *adsr, float release) {
-	adsr->release = release * 0.000244f + DEFAULT_RELEASE;
+	adsr->release = release;
+	adsr->release_coeff = getAdsrCoeff(release);
 }
 
 /* =========== Midi ============ */
+// A retriggered envelope restarts the attack from its current level
 void adsrNoteOn(Adsr *adsr) {
-	adsr->step = 1/(adsr->attack * adsr->sr);	// How much to increment the envelope every sample
 	adsr->state = ADSR_ATTACK;
 }
 void adsrNoteOff(Adsr *adsr) {
-	adsr->step = 1/(adsr->release * adsr->sr);	// How much to decrement the envelope every sample
-	adsr->state = ADSR_RELEASE;
+	if(adsr->state != ADSR_IDLE) {
+		adsr->state = ADSR_RELEASE;
+	}
 }
 
 /* ======== Processing ========= */
-void getAdsrAudioBlock(Adsr *adsr, float *out_buffer) {
-	for(int i = 0; i < BUFFER_SIZE; i++) {
-		out_buffer[i] *= getAdsrEnvelope(adsr);
+// Multiplies the buffer by the envelope, one tight loop per segment
+RAM_FUNC void getAdsrAudioBlock(Adsr *adsr, float *buffer, int length) {
+	float env = adsr->env;
+	int i = 0;
+
+	while(i < length) {
+		switch(adsr->state) {
+			case ADSR_ATTACK:
+				for(; i < length && env < 1.0f; i++) {
+					env += (ADSR_ATTACK_TARGET - env) * adsr->attack_coeff;
+					buffer[i] *= env;
+				}
+				if(env >= 1.0f) {
+					env = 1.0f;
+					adsr->state = ADSR_DECAY;
+				}
+			break;
+			case ADSR_DECAY:
+				for(; i < length && fabsf(env - adsr->sustain) > ADSR_EPSILON; i++) {
+					env += (adsr->sustain - env) * adsr->decay_coeff;
+					buffer[i] *= env;
+				}
+				if(fabsf(env - adsr->sustain) <= ADSR_EPSILON) {
+					adsr->state = ADSR_SUSTAIN;
+				}
+			break;
+			case ADSR_SUSTAIN:
+				env = adsr->sustain;
+				for(; i < length; i++) {
+					buffer[i] *= env;
+				}
+			break;
+			case ADSR_RELEASE:
+				for(; i < length && env > ADSR_EPSILON; i++) {
+					env -= env * adsr->release_coeff;
+					buffer[i] *= env;
+				}
+				if(env <= ADSR_EPSILON) {
+					env = 0.0f;
+					adsr->state = ADSR_IDLE;
+					adsr->reset_voice = 1;
+				}
+			break;
+			default:	// ADSR_IDLE
+				env = 0.0f;
+				memset(&buffer[i], 0, (length - i) * sizeof(float));
+				i = length;
+		}
 	}
+	adsr->env = env;
 }
+
 float getAdsrEnvelope(Adsr *adsr) {
-	switch(adsr->state) {
-		case ADSR_IDLE:
-			adsr->env = 0.0f;
-		break;
-		case ADSR_ATTACK:
-			adsr->env += adsr->step;
-			if (adsr->env >= 1.0f) {
-				adsr->state = ADSR_SUSTAIN;
-			}
-		break;
-		case ADSR_RELEASE:
-			adsr->env -= adsr->step;
-			if (adsr->env <= 0.0f) {
-				adsr->state = ADSR_IDLE;
-				adsr->reset_voice = 1;
-			}
-		break;
-		case ADSR_SUSTAIN:
-			adsr->env = 1.0f;
-		break;
-		default:
-			adsr->env = 0.0f;
+	float env = 1.0f;
+	getAdsrAudioBlock(adsr, &env, 1);
+	return env;
+}
+
+/* ========== Private functions ========== */
+// Times spaced exponentially, each coefficient gets within ADSR_EPSILON in that time
+static void buildAdsrTable(float sr) {
+	float ratio = logf(ADSR_MAX_TIME / ADSR_MIN_TIME) / (ADSR_TABLE_SIZE - 1);
+	for(int i = 0; i < ADSR_TABLE_SIZE; i++) {
+		float time = ADSR_MIN_TIME * expf(ratio * i);
+		adsr_coeff_table[i] = 1.0f - expf(logf(ADSR_EPSILON) / (time * sr));
 	}
-	return adsr->env;
+	adsr_table_sr = sr;
+}
+
+static float getAdsrCoeff(float pot_value) {
+	int index = (int)pot_value >> 4;
+	index = index < 0 ? 0 : index;
+	return adsr_coeff_table[index < ADSR_TABLE_SIZE ? index : ADSR_TABLE_SIZE - 1];
 }
@@ -8,32 +8,10 @@
 
 #include "dsp/blit.h"
 
-/* ========== Init functions ========== */
-void createBlitTable(Blit *blit) {
-	float step = 0.0039f; // 1/256 -> (1/n_sinc)
-	float temp = 0.0f;
-	float totalSum = 0.0f;
-
-	for (int i = 0; i < 256; i++) {
-		totalSum = 0.0f;
-		temp = step * i;
-
-		for (int x = 0; x < 16; x++) {
-			blit->blits_matrix[i][x] = x == 8 ?
-				(!temp ? (2.0f * 3.14f * 0.45f) : (sinf(2.0f * 3.14f * 0.45f * (-temp)) / (-temp))) :
-				(sinf(2.0f * 3.14f * 0.45f * (x - 8.0f - temp)) / (x - 8.0f - temp));
-			blit->blits_matrix[i][x] *= (0.51f - 0.49f * (cosf(2.0f * 3.14f * (x - temp) / 16.0f)));
-
-			totalSum += blit->blits_matrix[i][x];
-		}
-
-		// Normalize (Sum of all sample = 1)
-		for (int x = 0; x < 16; x++) {
-			blit->blits_matrix[i][x] /= totalSum;
-		}
-	}
-}
+/* ========== Private functions ========== */
+static int scheduleSquareEdges(Blit *blit, float period, int max_run);
 
+/* ========== Init functions ========== */
 void setupBlit(Blit *blit, float sr) {
     blit->sr 				= sr;
 	blit->sp 				= 1.0f / sr;
@@ -57,8 +35,6 @@ void setupBlit(Blit *blit, float sr) {
 	blit->index 						= 0;
 	memset(&blit->p_blit, 0, sizeof(blit->p_blit));
 	memset(&blit->n_blit, 0, sizeof(blit->n_blit));
-	memset(&blit->blits_matrix, 0, sizeof(blit->blits_matrix));
-	createBlitTable(blit);
 
 	//alpha = exp(-(LEAKY_INTEGRATOR_BASE_FREQUENCY / sr) * MathConstants<double>::twoPi);
 	//leakMod   = alpha - exp(-(LEAKY_INTEGRATOR_MOD_FREQUENCY/sr) * MathConstants<double>::twoPi);
@@ -67,27 +43,33 @@ void setupBlit(Blit *blit, float sr) {
 	//leakTrMod = alpha - exp(-(LEAKY_INTEGRATOR_TRI_MOD_FREQUENCY / sr) * MathConstants<double>::twoPi);
 }
 
+// The blit table is normalized to the sample period, only sr and sp follow the rate
+void setBlitSampleRate(Blit *blit, float sr) {
+	blit->sr = sr;
+	blit->sp = 1.0f / sr;
+}
+
 /* ========== Utils functions ========== */
-void getPositiveBlit(Blit *blit) {
+RAM_FUNC void getPositiveBlit(Blit *blit) {
 	int blit_index = 0;
     blit->sub_offset1 = blit->p_edge - (int)blit->p_edge;
-	blit_index = blit->sub_offset1 * 256;
+	blit_index = blit->sub_offset1 * BLIT_TABLE_PHASES;
 	uint8_t j = blit->index;
-	float *temp_blit = blit->blits_matrix[blit_index];
-	for (int i = 0; i < 16; i++) {
-		blit->p_blit[j] += temp_blit[i];
+	const float *temp_blit = blit_table[blit_index];
+	for (int i = 0; i < BLIT_TABLE_TAPS; i++) {
+		blit->p_blit[j & BLIT_RING_MASK] += temp_blit[i];
 		j++;
 	}
 }
 
-void getNegativeBlit(Blit *blit) {
+RAM_FUNC void getNegativeBlit(Blit *blit) {
 	int blit_index = 0;
 	blit->sub_offset2 = blit->n_edge - (int)blit->n_edge;
-	blit_index = blit->sub_offset2 * 256;
+	blit_index = blit->sub_offset2 * BLIT_TABLE_PHASES;
 	uint8_t j = blit->index;
-	float *temp_blit = blit->blits_matrix[blit_index];
-	for (int i = 0; i < 16; i++) {
-		blit->n_blit[j] -= temp_blit[i];
+	const float *temp_blit = blit_table[blit_index];
+	for (int i = 0; i < BLIT_TABLE_TAPS; i++) {
+		blit->n_blit[j & BLIT_RING_MASK] -= temp_blit[i];
 		j++;
 	}
 }
@@ -134,7 +116,7 @@ float getBlitSample(Blit *blit, float f, int waveform) {
 	blit->p_blit[blit->index] = 0.0f;
 	blit->n_blit[blit->index] = 0.0f;
 	blit->sample_cont++;
-	blit->index++;
+	blit->index = (blit->index + 1) & BLIT_RING_MASK;
 	return temp_sample;
 }
 
@@ -175,3 +157,140 @@ float getSquareSample(Blit *blit, float f) {
 	//accSquare = pBlit[index] + nBlit[index];
 	return blit->acc_square;
 }
+
+/* ========== Block functions ========== */
+// Same output as calling getBlitSample() length times with a constant f, but the
+// edges are scheduled once per period and every waveform has its own inner loop
+RAM_FUNC void getBlitAudioBlock(Blit *blit, float f, int waveform, float *out_buffer, int length) {
+	blit->decrement_step = f / blit->sr;
+
+	switch (waveform) {
+		case TRIANGLE:
+			getTriAudioBlock(blit, f, out_buffer, length);
+			break;
+		case SAWTOOTH:
+			getSawAudioBlock(blit, f, out_buffer, length);
+			break;
+		case SQUARE:
+			getSquareAudioBlock(blit, f, out_buffer, length);
+			break;
+		default:
+			memset(out_buffer, 0, length * sizeof(float));
+	}
+}
+
+RAM_FUNC void getTriAudioBlock(Blit *blit, float f, float *out_buffer, int length) {
+	float period = blit->sr / f;
+	float alpha_square = blit->alpha_coeff - blit->leakiness;
+	float alpha_tri = blit->alpha_coeff - blit->leakiness_tri;
+	float tri_gain = 4.0f * f * blit->sp;
+	float acc_square = blit->acc_square;
+	float acc_tri = blit->acc_tri;
+	int i = 0;
+
+	while (i < length) {
+		int run = scheduleSquareEdges(blit, period, length - i);
+		uint8_t index = blit->index;
+
+		for (int k = 0; k < run; k++) {
+			acc_square = acc_square * alpha_square + blit->p_blit[index] + blit->n_blit[index];
+			acc_tri = acc_tri * alpha_tri + acc_square * tri_gain;
+			blit->p_blit[index] = 0.0f;
+			blit->n_blit[index] = 0.0f;
+			index = (index + 1) & BLIT_RING_MASK;
+			out_buffer[i++] = acc_tri;
+		}
+
+		blit->index = index;
+		blit->sample_cont += run;
+	}
+
+	blit->acc_square = acc_square;
+	blit->acc_tri = acc_tri;
+}
+
+RAM_FUNC void getSawAudioBlock(Blit *blit, float f, float *out_buffer, int length) {
+	float period = blit->sr / f;
+	float alpha = blit->alpha_coeff - blit->leakiness;
+	float acc_saw = blit->acc_saw;
+	int i = 0;
+
+	while (i < length) {
+		blit->n_edge = period + blit->sub_offset2;
+		if (blit->sample_cont >= (int)blit->n_edge) {
+			blit->sample_cont = 0;
+			getNegativeBlit(blit);
+			blit->n_edge = period + blit->sub_offset2;	// Next edge
+		}
+
+		int run = (int)blit->n_edge - blit->sample_cont;
+		if (run < 1) run = 1;
+		if (run > length - i) run = length - i;
+		uint8_t index = blit->index;
+
+		for (int k = 0; k < run; k++) {
+			acc_saw = acc_saw * alpha + blit->n_blit[index] + blit->decrement_step;
+			blit->n_blit[index] = 0.0f;
+			blit->p_blit[index] = 0.0f;
+			index = (index + 1) & BLIT_RING_MASK;
+			out_buffer[i++] = acc_saw;
+		}
+
+		blit->index = index;
+		blit->sample_cont += run;
+	}
+
+	blit->acc_saw = acc_saw;
+}
+
+RAM_FUNC void getSquareAudioBlock(Blit *blit, float f, float *out_buffer, int length) {
+	float period = blit->sr / f;
+	float alpha = blit->alpha_coeff - blit->leakiness;
+	float acc_square = blit->acc_square;
+	int i = 0;
+
+	while (i < length) {
+		int run = scheduleSquareEdges(blit, period, length - i);
+		uint8_t index = blit->index;
+
+		for (int k = 0; k < run; k++) {
+			acc_square = acc_square * alpha + blit->p_blit[index] + blit->n_blit[index];
+			blit->p_blit[index] = 0.0f;
+			blit->n_blit[index] = 0.0f;
+			index = (index + 1) & BLIT_RING_MASK;
+			out_buffer[i++] = acc_square;
+		}
+
+		blit->index = index;
+		blit->sample_cont += run;
+	}
+
+	blit->acc_square = acc_square;
+}
+
+/* ========== Private functions ========== */
+// Fires the edges due at the current sample and returns how many samples can be
+// rendered before the next one (at least 1, at most max_run)
+RAM_FUNC static int scheduleSquareEdges(Blit *blit, float period, int max_run) {
+	blit->p_edge = period + blit->sub_offset1;
+	blit->n_edge = (blit->p_edge + blit->sub_offset1) * 0.5f;
+
+	if (blit->sample_cont >= (int)blit->p_edge) {
+		blit->passed_neg = false;
+		blit->sample_cont = 0;
+		getPositiveBlit(blit);
+	}
+	if (negativeEdgeCrossed(blit)) getNegativeBlit(blit);
+
+	// Next edges, with the sub-sample offset of the current period
+	float p_edge = period + blit->sub_offset1;
+	int run = (int)p_edge - blit->sample_cont;
+	if (!blit->passed_neg) {
+		int neg_run = (int)((p_edge + blit->sub_offset1) * 0.5f) - blit->sample_cont;
+		if (neg_run < run) run = neg_run;
+	}
+
+	if (run < 1) run = 1;
+	if (run > max_run) run = max_run;
+	return run;
+}
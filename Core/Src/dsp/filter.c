@@ -8,6 +8,9 @@
 
 #include "dsp/filter.h"
 
+/* ========== Private functions ========== */
+static void lookupFilterCoefficients(Filter *f, float cutoff, float *coeffs);
+
 /* ========== Constructor ==========*/
 
 void setupFilter(Filter *f, float sr) {
@@ -15,10 +18,12 @@ void setupFilter(Filter *f, float sr) {
 	f->sp 		= 1.0f/sr;
 	f->cutoff 	= DEFAULT_CUTOFF_RATE;
 	f->k 		= DEFAULT_RESONANCE;
-	f->g		= (2*M_PI*f->cutoff)*(1/sr)*0.5f;
-	f->Glp		= f->g/(1+f->g);
-	f->Gtot		= f->g*f->g*f->g*f->g; //powf(f->g, 4.0f);
 	f->coeff 	= 1;
+	f->g_step		= 0.0f;
+	f->Glp_step		= 0.0f;
+	f->inv_den_step	= 0.0f;
+	f->saturator = DEFAULT_SATURATOR;
+	updateFilterCutoff(f, f->cutoff);
 
 	memset(&f->v, 0, sizeof(f->v));
 	memset(&f->s, 0, sizeof(f->s));
@@ -28,34 +33,85 @@ void setupFilter(Filter *f, float sr) {
 
 
 /* ========== Parameters ==========*/
+// Rate the filter runs at (the oversampled one when it is oversampled)
+void setFilterSampleRate(Filter *f, float sr) {
+	f->sr = sr;
+	f->sp = 1.0f/sr;
+	updateFilterCutoff(f, f->cutoff);
+}
 
 void updateFilterCutoff(Filter *f, float cutoff) {
+	float coeffs[3];
+	lookupFilterCoefficients(f, cutoff, coeffs);
+
 	f->cutoff 	= cutoff;
-	f->g		= (2*M_PI*cutoff)*(1/f->sr)*0.5f;
-	f->Glp 		= f->g/(1+f->g);
-	f->Gtot 	= f->g*f->g*f->g*f->g; // powf(f->g, 4.0f);
+	f->g		= coeffs[FILTER_G];
+	f->Glp 		= coeffs[FILTER_GLP];
+	f->Gtot 	= coeffs[FILTER_GTOT];
+	f->inv_den	= 1.0f/(1.0f + f->k*f->Gtot);
+}
 
+// The coefficients move linearly from the current ones and reach the new
+// cutoff on the last sample of the control block (inv_length = 1/length)
+void setFilterCutoffRamp(Filter *f, float cutoff, float inv_length) {
+	float coeffs[3];
+	lookupFilterCoefficients(f, cutoff, coeffs);
+	float inv_den 	= 1.0f/(1.0f + f->k*coeffs[FILTER_GTOT]);
+
+	f->cutoff 		= cutoff;
+	f->Gtot 		= coeffs[FILTER_GTOT];
+	f->g_step 		= (coeffs[FILTER_G] - f->g) * inv_length;
+	f->Glp_step 	= (coeffs[FILTER_GLP] - f->Glp) * inv_length;
+	f->inv_den_step = (inv_den - f->inv_den) * inv_length;
 }
 
 
 void setFilterResonance(Filter *f, float resonance) {
 	f->k = resonance * 0.000488;	// [0, 2]
 	f->coeff  = 1 + f->k *2.0f;
+	f->inv_den = 1.0f/(1.0f + f->k*f->Gtot);
+}
+
+void setFilterSaturator(Filter *f, enum Saturator saturator) {
+	f->saturator = saturator;
 }
 
 /*========== Processing ==========*/
-void getFilterAudioBlock(Filter *filter, float *fm_buffer, float *out_buffer) {
-	for(int i = 0; i < BUFFER_SIZE; i++) {
-		updateFilterCutoff(filter, fm_buffer[i]);
-		out_buffer[i] = getFilterSample(filter, out_buffer[i]);
+// In place, along the ramp set by setFilterCutoffRamp(): no division in the loop
+RAM_FUNC void getFilterAudioBlock(Filter *f, float *buffer, int length) {
+	float g = f->g, Glp = f->Glp, inv_den = f->inv_den;
+	float s0 = f->s[0], s1 = f->s[1], s2 = f->s[2], s3 = f->s[3];
+	float v, y;
+
+	for(int i = 0; i < length; i++) {
+		g 		+= f->g_step;
+		Glp 	+= f->Glp_step;
+		inv_den += f->inv_den_step;
+
+		// Pre-calculus
+		float S = ((g*s0 + s1)*g + s2)*g + s3;
+		float u = (buffer[i] - f->k*S)*inv_den;
+		u = saturate(f->saturator, u);
+
+		// Forward path
+		v = (u - s0)*Glp;  y = v + s0; s0 = y + v;
+		v = (y - s1)*Glp;  y = v + s1; s1 = y + v;
+		v = (y - s2)*Glp;  y = v + s2; s2 = y + v;
+		v = (y - s3)*Glp;  y = v + s3; s3 = y + v;
+
+		buffer[i] = y * f->coeff;
 	}
+
+	f->g = g; f->Glp = Glp; f->inv_den = inv_den;
+	f->s[0] = s0; f->s[1] = s1; f->s[2] = s2; f->s[3] = s3;
+	f->g_step = 0.0f; f->Glp_step = 0.0f; f->inv_den_step = 0.0f;	// Hold the cutoff until the next ramp
 }
 
-float getFilterSample(Filter *f, float x) {
+RAM_FUNC float getFilterSample(Filter *f, float x) {
 	// Pre-calculus
 	float S = f->g*f->g*f->g*f->s[0] + f->g*f->g*f->s[1] + f->g*f->s[2] + f->s[3];
-	float u = (x - f->k*S)/(1+f->k*f->Gtot);
-	u = tanhf(u);
+	float u = (x - f->k*S)*f->inv_den;
+	u = saturate(f->saturator, u);
 
 	// Forward path
 	// Filter 1
@@ -81,8 +137,20 @@ float getFilterSample(Filter *f, float x) {
 	return f->y[3] * f->coeff;
 }
 
-
-
-
-
-
+/* ========== Private functions ========== */
+// Prewarped coefficients (g = tan(pi*fc/sr)) interpolated from filter_table.
+// The cutoff is clamped to the range of the table, [fc/sr = 2^-13, 0.42]
+static void lookupFilterCoefficients(Filter *f, float cutoff, float *coeffs) {
+	float position = (fastLog2f(cutoff * f->sp) - FILTER_TABLE_LOG2_MIN) * FILTER_TABLE_STEPS;
+	position = position < 0.0f ? 0.0f : position;
+	position = position > FILTER_TABLE_SIZE ? FILTER_TABLE_SIZE : position;
+	int index = (int)position;
+	index = index < FILTER_TABLE_SIZE ? index : FILTER_TABLE_SIZE - 1;
+	float fraction = position - index;
+
+	const float *row = filter_table[index];
+	const float *next = filter_table[index + 1];
+	for(int c = 0; c < 3; c++) {
+		coeffs[c] = row[c] + fraction * (next[c] - row[c]);
+	}
+}
@@ -3,53 +3,152 @@
   * @file    lfo.c
   * @author  Bianchi Davide
   * @brief   This file contains the whole structure and function of the lfo.
+  * 	     The phase is a 32-bit accumulator that wraps by itself: the
+  * 	     increment is computed only when the frequency changes.
   ******************************************************************************
 **/
 
 #include "dsp/lfo.h"
 
+#define PHASE_TO_BIPOLAR	(1.0f/2147483648.0f)	// [-2^31, 2^31) -> [-1, 1)
+#define SINE_FRACTION_BITS	(32 - SINE_TABLE_BITS)
+#define SINE_FRACTION_MASK	((1u << SINE_FRACTION_BITS) - 1)
+#define SINE_FRACTION_SCALE	(1.0f/(1u << SINE_FRACTION_BITS))
+
+/* ========== Private functions ========== */
+static inline float getLfoShape(Lfo *lfo, uint32_t phase);
+static inline void nextHoldValue(Lfo *lfo);
+
 /* ========== Constructor ==========*/
 void setupLfo(Lfo *lfo, float sr) {
 	lfo->sr 				= sr;
-	lfo->f 					= DEFAULT_RATE_LFO;
+	lfo->phase_scale		= LFO_PHASE_SCALE/sr;
+	lfo->gain				= DEFAULT_GAIN_LFO;
 	lfo->sample_value 		= 0.0f;
-	lfo->phase_increment	= lfo->f/lfo->sr;
-	lfo->phase_value 		= 0.0f;
+	lfo->phase_value 		= 0;
+	lfo->random_seed		= 22222;
+	lfo->hold_value			= 0.0f;
 	lfo->waveform 			= DEFAULT_WF_LFO;
+	setLfoFrequency(lfo, DEFAULT_RATE_LFO);
 }
 
 /* ========== Parameters ==========*/
+// Keeps the frequency in Hz
+void setLfoSampleRate(Lfo *lfo, float sr) {
+	lfo->sr 			= sr;
+	lfo->phase_scale 	= LFO_PHASE_SCALE/sr;
+	setLfoFrequency(lfo, lfo->f);
+}
+
 void setLfoWaveform(Lfo *lfo, int waveform) {
-	lfo->waveform = waveform;
+	lfo->waveform = waveform < LFO_WAVEFORM_COUNT ? waveform : LFO_TRIANGLE;
 }
 
+// Osc stand-ins reach audio rates: the increment is held below Nyquist, since
+// out of [0, 2^32) the float -> uint32_t conversion is undefined
 void setLfoFrequency(Lfo *lfo, float f) {
+	float nyquist = 0.5f * lfo->sr;
 	lfo->f = f;
+	f = f > nyquist ? nyquist : f;
+	f = f < 0.0f ? 0.0f : f;
+	lfo->phase_increment = (uint32_t)(f * lfo->phase_scale);
+}
+
+void setLfoGain(Lfo *lfo, float gain) {
+	lfo->gain = gain;
 }
 
 /* ========== Processing ==========*/
-void getLfoAudioBlock(Lfo *lfo, float *out_buffer) {
-	for(int i = 0; i < BUFFER_SIZE; i++) {
-		out_buffer[i] = getLfoSample(lfo);
+// One loop per shape, the shape is not tested inside the loop
+void getLfoAudioBlock(Lfo *lfo, float *out_buffer, int length) {
+	uint32_t phase = lfo->phase_value;
+	uint32_t increment = lfo->phase_increment;
+	float gain = lfo->gain;
+
+	switch (lfo->waveform) {
+		case LFO_TRIANGLE:
+			for(int i = 0; i < length; i++, phase += increment) {
+				float x = (float)(int32_t)(phase ^ 0x80000000) * PHASE_TO_BIPOLAR;
+				out_buffer[i] = (2.0f * fabsf(x) - 1.0f) * gain;
+			}
+		break;
+		case LFO_SAWTOOTH:
+			for(int i = 0; i < length; i++, phase += increment) {
+				out_buffer[i] = (float)(int32_t)(phase ^ 0x80000000) * PHASE_TO_BIPOLAR * gain;
+			}
+		break;
+		case LFO_SQUARE:
+			for(int i = 0; i < length; i++, phase += increment) {
+				out_buffer[i] = phase < 0x80000000 ? -gain : gain;
+			}
+		break;
+		case LFO_SINE:
+			for(int i = 0; i < length; i++, phase += increment) {
+				uint32_t index = phase >> SINE_FRACTION_BITS;
+				float fraction = (float)(phase & SINE_FRACTION_MASK) * SINE_FRACTION_SCALE;
+				out_buffer[i] = (sine_table[index] + fraction * (sine_table[index + 1] - sine_table[index])) * gain;
+			}
+		break;
+		case LFO_SAMPLE_HOLD:
+			for(int i = 0; i < length; i++) {
+				out_buffer[i] = lfo->hold_value * gain;
+				phase += increment;
+				if(phase < increment) {		// Wrapped: new period
+					nextHoldValue(lfo);
+				}
+			}
+		break;
+		default:
+			memset(out_buffer, 0, length * sizeof(float));
 	}
+
+	lfo->phase_value = phase;
+	lfo->sample_value = out_buffer[length - 1];
 }
 
 float getLfoSample(Lfo *lfo) {
+	return getLfoControlSample(lfo, 1);
+}
+
+// One value for a whole control block: the phase moves on by length samples
+float getLfoControlSample(Lfo *lfo, int length) {
+	lfo->sample_value = getLfoShape(lfo, lfo->phase_value) * lfo->gain;
+
+	uint64_t phase = (uint64_t)lfo->phase_value + (uint64_t)lfo->phase_increment * length;
+	if(phase >> 32) {
+		nextHoldValue(lfo);
+	}
+	lfo->phase_value = (uint32_t)phase;
+	return lfo->sample_value;
+}
+
+/* ========== Private functions ========== */
+// Value of the shape at a phase, in [-1, 1]
+static inline float getLfoShape(Lfo *lfo, uint32_t phase) {
+	int32_t bipolar = (int32_t)(phase ^ 0x80000000);		// 2*phase - 1
 	switch (lfo->waveform) {
-		case TRIANGLE:
-			lfo->sample_value = 4.0f * fabs(lfo->phase_value - 0.5f) - 1.0;
-			break;
-		case SAWTOOTH:
-			lfo->sample_value = 2.0f * lfo->phase_value - 1.0f;
-			break;
-		case SQUARE:
-			lfo->sample_value = (lfo->phase_value > 0.5f) - (lfo->phase_value < 0.5f);
-			break;
+		case LFO_TRIANGLE: {
+			float x = (float)bipolar * PHASE_TO_BIPOLAR;
+			return 2.0f * fabsf(x) - 1.0f;
+		}
+		case LFO_SAWTOOTH:
+			return (float)bipolar * PHASE_TO_BIPOLAR;
+		case LFO_SQUARE:
+			return phase < 0x80000000 ? -1.0f : 1.0f;
+		case LFO_SINE: {
+			uint32_t index = phase >> SINE_FRACTION_BITS;
+			float fraction = (float)(phase & SINE_FRACTION_MASK) * SINE_FRACTION_SCALE;
+			return sine_table[index] + fraction * (sine_table[index + 1] - sine_table[index]);
+		}
+		case LFO_SAMPLE_HOLD:
+			return lfo->hold_value;
 		default:
-			lfo->sample_value = 0.0f;
+			return 0.0f;
 	}
-	lfo->phase_increment = lfo->f / lfo->sr;
-	lfo->phase_value += lfo->phase_increment;
-	lfo->phase_value -= (int) lfo->phase_value;
-	return lfo->sample_value;
+}
+
+// Numerical Recipes LCG, new random level in [-1, 1)
+static inline void nextHoldValue(Lfo *lfo) {
+	lfo->random_seed = lfo->random_seed * 1664525u + 1013904223u;
+	lfo->hold_value = (float)(int32_t)lfo->random_seed * PHASE_TO_BIPOLAR;
 }
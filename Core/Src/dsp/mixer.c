@@ -37,8 +37,8 @@ void setGainOsc2(Mixer *mixer, float gain2) {
 }
 
 /* ========== Processing ==========*/
-void getMixerAudioBlock(Mixer *mixer, float *out_buffer, float *buffer_osc1, float *buffer_osc2) {
-	for(int i = 0; i < BUFFER_SIZE; i++) {
+RAM_FUNC void getMixerAudioBlock(Mixer *mixer, float *out_buffer, float *buffer_osc1, float *buffer_osc2, int length) {
+	for(int i = 0; i < length; i++) {
 		buffer_osc1[i] *= mixer->gain_osc1;
 		buffer_osc2[i] *= mixer->gain_osc2;
 		out_buffer[i] = (buffer_osc1[i] + buffer_osc2[i]);
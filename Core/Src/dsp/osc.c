@@ -19,6 +19,12 @@ void setupOsc(Osc *osc, float sr) {
 }
 
 /* ========== Parameters ==========*/
+void setOscSampleRate(Osc *osc, float sr) {
+	osc->sr = sr;
+	setBlitSampleRate(&osc->blit, sr);
+	setLfoSampleRate(&osc->lfo, sr);
+}
+
 void setOscWaveform(Osc *osc, int waveform) {
 	osc->waveform = waveform;
 	setLfoWaveform(&osc->lfo, waveform);
@@ -30,11 +36,13 @@ void setOscFrequency(Osc *osc, float frequency) {
 }
 
 /* ========== Processing ==========*/
-void getOscAudioBlock(Osc *osc, float *fm_buffer, float *out_buffer) {
-	for(int i = 0; i < BUFFER_SIZE; i++) {
-		setOscFrequency(osc, fm_buffer[i]);
-		out_buffer[i] = getOscSample(osc);
+RAM_FUNC void getOscAudioBlock(Osc *osc, float *out_buffer, int length) {
+	if(osc->f <= 20) {
+		getLfoAudioBlock(&osc->lfo, out_buffer, length);
+	} else {
+		getBlitAudioBlock(&osc->blit, osc->f, osc->waveform, out_buffer, length);
 	}
+	osc->sample_value = out_buffer[length - 1];
 }
 
 float getOscSample(Osc *osc) {
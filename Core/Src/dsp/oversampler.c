@@ -0,0 +1,124 @@
+/**
+  ******************************************************************************
+  * @file    oversampler.c
+  * @author  Bianchi Davide
+  * @brief   This file contains the whole structure and function of the
+  * 	     oversampler: one or two polyphase half-band 2x stages that run the
+  * 	     filter at 2 or 4 times the sample rate.
+  * 	     Only the odd-phase taps are computed, the other phase of a
+  * 	     half-band is a pure delay.
+  ******************************************************************************
+**/
+
+#include "dsp/oversampler.h"
+
+#define OVERSAMPLER_WORK_SIZE	(HALFBAND_DOWN_HISTORY + MAX_CONTROL_BLOCK_SIZE*OVERSAMPLING_MAX)
+
+// Scratch buffers shared by every instance (the voices are rendered one at a time)
+CCM_DATA static float work_buffer[OVERSAMPLER_WORK_SIZE];
+CCM_DATA static float stage_buffer[MAX_CONTROL_BLOCK_SIZE*2];
+
+/* ========== Private functions ========== */
+static void interpolateStage(HalfbandStage *stage, float *in_buffer, float *out_buffer, int length);
+static void decimateStage(HalfbandStage *stage, float *in_buffer, float *out_buffer, int length);
+
+/* ========== Constructor ==========*/
+void setupOversampler(Oversampler *os) {
+	os->stages[0].coeffs 	= halfband_1_table;
+	os->stages[0].taps 		= HALFBAND_1_TAPS;
+#if OVERSAMPLING_STAGES > 1
+	os->stages[1].coeffs 	= halfband_2_table;
+	os->stages[1].taps 		= HALFBAND_2_TAPS;
+#endif
+	setOversamplerFactor(os, DEFAULT_OVERSAMPLING);
+}
+
+/* ========== Parameters ==========*/
+// Rounded down to 1, 2 or 4 and limited to OVERSAMPLING_MAX
+void setOversamplerFactor(Oversampler *os, int factor) {
+	if(factor >= 4 && OVERSAMPLING_MAX >= 4) {
+		os->factor = 4;
+	} else if(factor >= 2 && OVERSAMPLING_MAX >= 2) {
+		os->factor = 2;
+	} else {
+		os->factor = 1;
+	}
+	os->inv_factor = 1.0f / os->factor;
+	clearOversampler(os);
+}
+
+void clearOversampler(Oversampler *os) {
+	for(int s = 0; s < OVERSAMPLING_STAGES; s++) {
+		memset(&os->stages[s].up_history, 0, sizeof(os->stages[s].up_history));
+		memset(&os->stages[s].down_history, 0, sizeof(os->stages[s].down_history));
+	}
+}
+
+/* ========== Processing ==========*/
+// length input samples -> length*factor output samples
+RAM_FUNC void upsampleAudioBlock(Oversampler *os, float *in_buffer, float *out_buffer, int length) {
+	if(os->factor == 4) {
+		interpolateStage(&os->stages[0], in_buffer, stage_buffer, length);
+		interpolateStage(&os->stages[OVERSAMPLING_STAGES - 1], stage_buffer, out_buffer, length*2);
+	} else if(os->factor == 2) {
+		interpolateStage(&os->stages[0], in_buffer, out_buffer, length);
+	} else {
+		memcpy(out_buffer, in_buffer, length*sizeof(float));
+	}
+}
+
+// length*factor input samples -> length output samples
+RAM_FUNC void downsampleAudioBlock(Oversampler *os, float *in_buffer, float *out_buffer, int length) {
+	if(os->factor == 4) {
+		decimateStage(&os->stages[OVERSAMPLING_STAGES - 1], in_buffer, stage_buffer, length*2);
+		decimateStage(&os->stages[0], stage_buffer, out_buffer, length);
+	} else if(os->factor == 2) {
+		decimateStage(&os->stages[0], in_buffer, out_buffer, length);
+	} else {
+		memcpy(out_buffer, in_buffer, length*sizeof(float));
+	}
+}
+
+/* ========== Private functions ========== */
+// Even outputs are the input delayed by taps samples, odd outputs the half-band taps
+RAM_FUNC static void interpolateStage(HalfbandStage *stage, float *in_buffer, float *out_buffer, int length) {
+	int taps = stage->taps;
+	int history = 2*taps - 1;
+	float *x = work_buffer;
+
+	memcpy(x, stage->up_history, history*sizeof(float));
+	memcpy(x + history, in_buffer, length*sizeof(float));
+
+	for(int n = 0; n < length; n++) {
+		float *centre = x + history + n - taps;		// Between centre[0] and centre[1]
+		float acc = 0.0f;
+		for(int j = 0; j < taps; j++) {
+			acc += stage->coeffs[j] * (centre[1 + j] + centre[-j]);
+		}
+		out_buffer[2*n] 	= centre[0];
+		out_buffer[2*n + 1] = 2.0f * acc;		// Gain of the zero stuffing
+	}
+
+	memcpy(stage->up_history, x + length, history*sizeof(float));
+}
+
+// length outputs from 2*length inputs, only the odd-phase taps are multiplied
+RAM_FUNC static void decimateStage(HalfbandStage *stage, float *in_buffer, float *out_buffer, int length) {
+	int taps = stage->taps;
+	int history = 4*taps - 3;
+	float *x = work_buffer;
+
+	memcpy(x, stage->down_history, history*sizeof(float));
+	memcpy(x + history, in_buffer, 2*length*sizeof(float));
+
+	for(int n = 0; n < length; n++) {
+		float *centre = x + history + 2*n + 2 - 2*taps;
+		float acc = 0.5f * centre[0];
+		for(int j = 0; j < taps; j++) {
+			acc += stage->coeffs[j] * (centre[2*j + 1] + centre[-2*j - 1]);
+		}
+		out_buffer[n] = acc;
+	}
+
+	memcpy(stage->down_history, x + 2*length, history*sizeof(float));
+}
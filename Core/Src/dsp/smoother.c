@@ -0,0 +1,53 @@
+/**
+  ******************************************************************************
+  * @file    smoother.c
+  * @author  Bianchi Davide
+  * @brief   This file contains the whole structure and function of the
+  * 	     parameter smoother: every new target starts a linear ramp of
+  * 	     ramp_steps steps from the current value.
+  ******************************************************************************
+**/
+
+#include "dsp/smoother.h"
+
+/* ========== Constructor ==========*/
+void setupSmoother(Smoother *smoother, float value, int ramp_steps) {
+	setSmootherRamp(smoother, ramp_steps);
+	setSmootherValue(smoother, value);
+}
+
+/* ========== Parameters ==========*/
+void setSmootherRamp(Smoother *smoother, int ramp_steps) {
+	smoother->ramp_steps = ramp_steps < 1 ? 1 : ramp_steps;
+	smoother->inv_ramp_steps = 1.0f / smoother->ramp_steps;
+}
+
+// Render context only: target, step and remaining are three separate stores
+void setSmootherTarget(Smoother *smoother, float target) {
+	if(target != smoother->target) {
+		smoother->target = target;
+		smoother->step = (target - smoother->current) * smoother->inv_ramp_steps;
+		smoother->remaining = smoother->ramp_steps;
+	}
+}
+
+// Jumps to the value without a ramp
+void setSmootherValue(Smoother *smoother, float value) {
+	smoother->current = value;
+	smoother->target = value;
+	smoother->step = 0.0f;
+	smoother->remaining = 0;
+}
+
+/* ========== Processing ==========*/
+float advanceSmoother(Smoother *smoother) {
+	if(smoother->remaining > 0) {
+		smoother->remaining--;
+		smoother->current = smoother->remaining ? smoother->current + smoother->step : smoother->target;
+	}
+	return smoother->current;
+}
+
+bool isSmootherActive(Smoother *smoother) {
+	return smoother->remaining > 0;
+}
@@ -11,23 +11,49 @@
 
 #include "dsp/synthesizer.h"
 
+/* ========== Private functions ========== */
+static void updateModulation(Synthesizer *synth, int length);
+static void updateSmoothers(Synthesizer *synth);
+static void renderVoice(Synthesizer *synth, Voice *voice, int length);
+static void polyNoteOn(Synthesizer *synth, uint8_t group, uint8_t midi_note, float velocity);
+static void polyNoteOff(Synthesizer *synth, uint8_t group, uint8_t midi_note);
+static void monoNoteOn(Synthesizer *synth, uint8_t midi_note, float velocity);
+static void monoNoteOff(Synthesizer *synth, uint8_t midi_note);
+static int findFreeVoice(Synthesizer *synth, VoiceGroup *group);
+static int findVoiceToSteal(Synthesizer *synth, VoiceGroup *group);
+static void pushHeldNote(Synthesizer *synth, uint8_t midi_note);
+static void removeHeldNote(Synthesizer *synth, uint8_t midi_note);
+static uint8_t getPriorityNote(Synthesizer *synth);
+static void setRegisteredParameter(Synthesizer *synth, float controller_value);
+static void startGlide(Synthesizer *synth, Voice *voice, float from_note, bool legato);
+static void updateGlideCoeff(Synthesizer *synth);
+
 /* ========== Constructor ==========*/
 void setupSynthesizer(Synthesizer *synth, float sr) {
 	// Setup Components
-	setupOsc(&synth->osc1, sr);
-	setupOsc(&synth->osc2, sr);
+	for(int v = 0; v < NUM_VOICES; v++) {
+		setupVoice(&synth->voices[v], sr);
+	}
 	setupLfo(&synth->lfo, sr);
 	setupMixer(&synth->mixer, sr);
-	setupAdsr(&synth->adsr, sr);
-	setupFilter(&synth->filter, sr);
 
 	// Setup Buffers
 	memset(&synth->buffer_osc1, 	0, sizeof(synth->buffer_osc1));
 	memset(&synth->buffer_osc2, 	0, sizeof(synth->buffer_osc2));
-	memset(&synth->am_buffer, 		0, sizeof(synth->am_buffer));
-	memset(&synth->fm_buffer_osc1, 	0, sizeof(synth->fm_buffer_osc1));
-	memset(&synth->fm_buffer_osc2, 	0, sizeof(synth->fm_buffer_osc2));
-	memset(&synth->fm_buffer_filter,0, sizeof(synth->fm_buffer_filter));
+	memset(&synth->mix_buffer, 		0, sizeof(synth->mix_buffer));
+
+	// Setup Voice allocation
+	memset(&synth->note_to_voice, 	NO_VOICE, sizeof(synth->note_to_voice));
+	memset(&synth->note_stack, 		0, sizeof(synth->note_stack));
+	synth->note_stack_count 	= 0;
+	synth->voice_age 			= 0;
+	synth->voice_mode 			= DEFAULT_VOICE_MODE;
+	synth->note_priority 		= DEFAULT_NOTE_PRIORITY;
+	synth->voice_steal 			= DEFAULT_VOICE_STEAL;
+	synth->voice_limit 			= NUM_VOICES;
+	for(int g = 0; g < NUM_VOICE_GROUPS; g++) {
+		setVoiceGroup(synth, g, 0, NUM_VOICES);
+	}
 
 	// Setup Variables
 	synth->sr 					= sr;
@@ -38,97 +64,242 @@ void setupSynthesizer(Synthesizer *synth, float sr) {
 	synth->mute_osc2 			= DEFAULT_MUTE_OSC_2;
 	synth->velocity 			= DEFAULT_VELOCITY;
 	synth->pitch_bend 			= DEFAULT_PITCH_WHEEL;
+	synth->bend_range 			= DEFAULT_BEND_RANGE;
+	synth->rpn_msb 				= 127;	// Null RPN
+	synth->rpn_lsb 				= 127;
 	synth->detune_osc2 			= DEFAULT_DETUNE;
 	synth->octave_osc1 			= DEFAULT_OCTAVE;
 	synth->octave_osc2  		= DEFAULT_OCTAVE;
-	synth->hertz_note			= DEFAULT_HERTZ_NOTE;
 	synth->filter_cutoff		= DEFAULT_CUTOFF_RATE;
+	synth->saturator 			= DEFAULT_SATURATOR;
+	synth->oversampling 		= DEFAULT_OVERSAMPLING;
 	synth->mod_wheel 			= DEFAULT_MODULATION_WHEEL;
 	synth->is_tremolo_mod_on	= DEFAULT_OSC_MODULATION;
 	synth->is_vibrato_mod_on	= DEFAULT_OSC_MODULATION;
 	synth->is_filter_mod_on 	= DEFAULT_FILTER_MODULATION;
 	synth->is_gain_enabled		= DEFAULT_GAIN_ENABLER;
-	synth->note_counter 		= 0;
-	synth->midi_note 			= 69;
+
+	// Setup Glide
+	synth->glide_mode 			= DEFAULT_GLIDE_MODE;
+	synth->glide_time 			= DEFAULT_GLIDE_TIME;
+	synth->last_note 			= DEFAULT_NOTE;
+
+	// Setup Smoothers (their ramp is set by setControlBlockSize())
+	setupSmoother(&synth->smoothers[SMOOTH_GAIN_OSC1], 	synth->gain_osc1, 1);
+	setupSmoother(&synth->smoothers[SMOOTH_GAIN_OSC2], 	synth->gain_osc2, 1);
+	setupSmoother(&synth->smoothers[SMOOTH_DETUNE_OSC2], synth->detune_osc2, 1);
+	setupSmoother(&synth->smoothers[SMOOTH_CUTOFF], 	synth->filter_cutoff, 1);
+	setupSmoother(&synth->smoothers[SMOOTH_RESONANCE], 	DEFAULT_RESONANCE / 0.000488f, 1);
+	setupSmoother(&synth->smoothers[SMOOTH_GAIN], 		synth->gain, 1);
+	setupSmoother(&synth->smoothers[SMOOTH_MOD_WHEEL], 	synth->mod_wheel, 1);
+
+	// Setup Modulation
+	setControlBlockSize(synth, DEFAULT_CONTROL_BLOCK_SIZE);
+	synth->modulation.pitch 			= 0.0f;
+	synth->modulation.cutoff 			= synth->filter_cutoff;
+	synth->modulation.inv_length		= 1.0f;
+	synth->modulation.amplitude 		= 0.0f;
+	synth->modulation.amplitude_target 	= 0.0f;
 }
 
+// Every sr-dependent state follows the new rate, the notes and the settings are kept
+void setSynthSampleRate(Synthesizer *synth, float sr) {
+	synth->sr = sr;
+	for(int v = 0; v < NUM_VOICES; v++) {
+		setVoiceSampleRate(&synth->voices[v], sr);
+	}
+	setLfoSampleRate(&synth->lfo, sr);
+	synth->mixer.sr = sr;
+	setControlBlockSize(synth, synth->modulation.block_size);	// Glide coefficient and smoother ramps
+}
 
 /* ========== Processing ========== */
 
-void getSynthAudioBlock(Synthesizer *synth, int16_t *out_buffer) {
+// Renders frames stereo frames (a half I2S buffer or the part before an event, any length) in control blocks.
+// The modulations run at the control rate (once every modulation.block_size
+// samples), the loops inside a control block are arithmetic only
+RAM_FUNC void getSynthAudioBlock(Synthesizer *synth, int16_t *out_buffer, int frames) {
 	uint16_t *p_buffer = out_buffer;
 	uint16_t dac_sample;
-	for(int i = 0; i < BUFFER_SIZE; i++) {
-		// Frequency Modulations
-		float mod_sample = getLfoSample(&synth->lfo);
-		float mod_amount = synth->mod_wheel * jmap(mod_sample, -1.0f, 1.0f, -0.5f, +0.5f); // [0.5, 1.5];
-		float bend_val = (synth->pitch_bend >= 0.5) ? jmap(synth->pitch_bend, 0.5f, 1.0f, 1.0f, 2.0f) : jmap(synth->pitch_bend, 0.0f, 0.5f, 0.5f, 1.0f);
+	int length = synth->modulation.block_size;
+	uint32_t block_start = PROFILE_TIME();
+
+	for(int offset = 0; offset < frames; offset += length) {
+		if(offset + length > frames) {
+			length = frames - offset;
+		}
+		uint32_t start = PROFILE_TIME();
+		updateModulation(synth, length);
+		PROFILE_ADD(PROFILE_MODULATION, start);
+
+		// Voices
+		memset(&synth->mix_buffer, 0, length*sizeof(float));
+		for(int v = 0; v < NUM_VOICES; v++) {
+			if(synth->voices[v].active) {
+				renderVoice(synth, &synth->voices[v], length);
+			}
+		}
 
-		float fm_osc1 = synth->hertz_note * bend_val + (synth->is_vibrato_mod_on ? synth->hertz_note*bend_val*mod_amount : 0.0f);
-		float fm_osc2 = fm_osc1 * synth->detune_osc2;
-		fm_osc1	*= synth->octave_osc1;
-		fm_osc2	*= synth->octave_osc2;
-		float fm_filter = synth->filter_cutoff + (synth->is_filter_mod_on ? synth->filter_cutoff*mod_amount : 0.0f);
+		// Final Gain
+		start = PROFILE_TIME();
+		float amplitude = synth->modulation.amplitude;
+		float amplitude_step = (synth->modulation.amplitude_target - amplitude) * synth->modulation.inv_length;
+		for(int i = 0; i < length; i++) {
+			amplitude += amplitude_step;
+			float sample = clampf(synth->mix_buffer[i] * amplitude, 1.0f);	// Out of the int16_t range the conversion is undefined
+
+			dac_sample = (uint16_t) ((int16_t) ((32767.0f) * sample)); // Conversion Float -> Int
+			*p_buffer++ = dac_sample; // Left Channel Sample
+			*p_buffer++ = dac_sample; // Right Channel Sample
+		}
+		synth->modulation.amplitude = synth->modulation.amplitude_target;
+		PROFILE_ADD(PROFILE_OUTPUT, start);
+	}
+	PROFILE_ADD(PROFILE_BLOCK, block_start);	// Committed by the audio driver once per half
+}
+
+// LFO, pitch bend, vibrato, filter modulation and tremolo of the next control block
+RAM_FUNC static void updateModulation(Synthesizer *synth, int length) {
+	Modulation *mod = &synth->modulation;
+	updateSmoothers(synth);
 
-		// Oscillator buffers
-		setOscFrequency(&synth->osc1, fm_osc1);
-		setOscFrequency(&synth->osc2, fm_osc2);
-		float sample = getOscSample(&synth->osc1)*synth->gain_osc1*synth->mute_osc1 + getOscSample(&synth->osc2)*synth->gain_osc2*synth->mute_osc2;
+	float mod_sample = getLfoControlSample(&synth->lfo, length);
+	float am = mod_sample * synth->mod_wheel;
+	float filter_amount = synth->mod_wheel * jmap(mod_sample, -1.0f, 1.0f, -0.5f, +0.5f); // [0.5, 1.5]
+	float bend = bendToSemitones(synth->pitch_bend, synth->bend_range);
 
-		// Filter
-		updateFilterCutoff(&synth->filter, fm_filter);
-		sample = getFilterSample(&synth->filter, sample);
+	mod->inv_length 		= 1.0f / length;
+	mod->pitch 				= bend + (synth->is_vibrato_mod_on ? am*DEFAULT_VIBRATO_RANGE : 0.0f);
+	mod->cutoff 			= synth->filter_cutoff + (synth->is_filter_mod_on ? synth->filter_cutoff*filter_amount : 0.0f);
+	mod->amplitude_target 	= (1.0f + (synth->is_tremolo_mod_on ? am : 0.0f))*(synth->gain * synth->is_gain_enabled) * VOICE_MIX_GAIN;
+}
 
-		// ADSR
-		sample *= getAdsrEnvelope(&synth->adsr);
+// One step of every ramp still running, the render loops read the stepped values
+static void updateSmoothers(Synthesizer *synth) {
+	Smoother *smoothers = synth->smoothers;
 
-		if((&synth->adsr)->reset_voice == 1) {
-			(&synth->adsr)->reset_voice = 0;
-			clearOscAccumulators(&synth->osc1);
-			clearOscAccumulators(&synth->osc2);
+	for(int p = 0; p < SMOOTH_COUNT; p++) {
+		if(!isSmootherActive(&smoothers[p])) {
+			continue;
+		}
+		float value = advanceSmoother(&smoothers[p]);
+		switch(p) {
+			case SMOOTH_GAIN_OSC1:		synth->gain_osc1 = value;		break;
+			case SMOOTH_GAIN_OSC2:		synth->gain_osc2 = value;		break;
+			case SMOOTH_DETUNE_OSC2:	synth->detune_osc2 = value;		break;
+			case SMOOTH_CUTOFF:			synth->filter_cutoff = value;	break;
+			case SMOOTH_GAIN:			synth->gain = value;			break;
+			case SMOOTH_MOD_WHEEL:		synth->mod_wheel = value;		break;
+			case SMOOTH_RESONANCE:
+				for(int v = 0; v < NUM_VOICES; v++) {
+					setFilterResonance(&synth->voices[v].filter, value);
+				}
+			break;
+			default:
+				;
 		}
+	}
+}
 
-		// Final Gain
-		float am_sample = mod_sample * synth->mod_wheel;
-		sample = (sample + (synth->is_tremolo_mod_on ? am_sample*sample: 0.0f))*(synth->gain * synth->is_gain_enabled);
+// Adds a voice (oscillators -> filter -> envelope) to the mix buffer
+RAM_FUNC static void renderVoice(Synthesizer *synth, Voice *voice, int length) {
+	float gain_osc1 = synth->gain_osc1*synth->mute_osc1;
+	float gain_osc2 = synth->gain_osc2*synth->mute_osc2;
+	uint32_t start = PROFILE_TIME();
 
-		dac_sample = (uint16_t) ((int16_t) ((32767.0f) * sample)); // Conversion Float -> Int
-		*p_buffer++ = dac_sample; // Left Channel Sample
-		*p_buffer++ = dac_sample; // Right Channel Sample
+	// Oscillator buffers (a muted oscillator is not rendered)
+	if(voice->note != voice->target_note) {
+		voiceGlide(voice, synth->glide_coeff);
+	}
+	float fm_osc1 = noteToHertz(voice->note + synth->modulation.pitch);
+	float fm_osc2 = fm_osc1 * synth->detune_osc2;
+	setOscFrequency(&voice->osc1, fm_osc1 * synth->octave_osc1);
+	setOscFrequency(&voice->osc2, fm_osc2 * synth->octave_osc2);
 
+	if(gain_osc1 != 0.0f) {
+		getOscAudioBlock(&voice->osc1, synth->buffer_osc1, length);
+	} else {
+		memset(&synth->buffer_osc1, 0, length*sizeof(float));
+	}
+	if(gain_osc2 != 0.0f) {
+		getOscAudioBlock(&voice->osc2, synth->buffer_osc2, length);
+	} else {
+		memset(&synth->buffer_osc2, 0, length*sizeof(float));
 	}
-}
 
+	for(int i = 0; i < length; i++) {
+		synth->buffer_osc1[i] = synth->buffer_osc1[i]*gain_osc1 + synth->buffer_osc2[i]*gain_osc2;
+	}
 
-void applyGain(Synthesizer *synth, float *out_buffer) {
-	for(int i = 0; i < BUFFER_SIZE; i++) {
-		out_buffer[i] = (out_buffer[i] + (synth->is_tremolo_mod_on ? synth->am_buffer[i]*out_buffer[i]: 0.0f))*(synth->gain * synth->is_gain_enabled);
+	PROFILE_ADD(PROFILE_OSC, start);
+
+	// Filter, oversampled because the tanh feedback aliases at the base rate
+	start = PROFILE_TIME();
+	Oversampler *os = &voice->oversampler;
+	setFilterCutoffRamp(&voice->filter, synth->modulation.cutoff, synth->modulation.inv_length * os->inv_factor);
+	if(os->factor > 1) {
+		upsampleAudioBlock(os, synth->buffer_osc1, synth->oversampled_buffer, length);
+		getFilterAudioBlock(&voice->filter, synth->oversampled_buffer, length * os->factor);
+		downsampleAudioBlock(os, synth->oversampled_buffer, synth->buffer_osc1, length);
+	} else {
+		getFilterAudioBlock(&voice->filter, synth->buffer_osc1, length);
+	}
+
+	PROFILE_ADD(PROFILE_FILTER, start);
+
+	// ADSR
+	start = PROFILE_TIME();
+	getAdsrAudioBlock(&voice->adsr, synth->buffer_osc1, length);
+	for(int i = 0; i < length; i++) {
+		synth->mix_buffer[i] += synth->buffer_osc1[i];
 	}
+	PROFILE_ADD(PROFILE_ENVELOPE, start);
+
+	voiceCheckEnd(voice);
 }
 
 /* ========== MIDI Parameters Functions ==========*/
-void synthesizerNoteOn(Synthesizer *synth, float hertz_note, float velocity) {
-	//synth->midi_note = midi_note;
-	synth->hertz_note = hertz_note;
+// The group only matters in poly: the mono mode has a single voice for all of them
+void synthesizerNoteOn(Synthesizer *synth, uint8_t group, uint8_t midi_note, float velocity) {
+	midi_note &= 0x7F;
 	synth->velocity = velocity;
-	synth->note_counter++;
-	adsrNoteOn(&synth->adsr);
+	if(synth->voice_mode == VOICE_MODE_MONO_LEGATO) {
+		monoNoteOn(synth, midi_note, velocity);
+	} else {
+		polyNoteOn(synth, group % NUM_VOICE_GROUPS, midi_note, velocity);
+	}
 }
 
-void synthesizerNoteOff(Synthesizer *synth, float hertz_note, float velocity) {
-	synth->velocity = velocity;	// Feature di più note da aggiungere dopo
-	synth->note_counter--;
-	if(synth->note_counter <= 0) {
-		adsrNoteOff(&synth->adsr);
-		//clearOscAccumulators(&synth->osc1);
-		//clearOscAccumulators(&synth->osc2);
+void synthesizerNoteOff(Synthesizer *synth, uint8_t group, uint8_t midi_note, float velocity) {
+	midi_note &= 0x7F;
+	synth->velocity = velocity;
+	if(synth->voice_mode == VOICE_MODE_MONO_LEGATO) {
+		monoNoteOff(synth, midi_note);
+	} else {
+		polyNoteOff(synth, group % NUM_VOICE_GROUPS, midi_note);
 	}
 }
 
+void synthesizerAllNotesOff(Synthesizer *synth) {
+	for(int v = 0; v < NUM_VOICES; v++) {
+		if(synth->voices[v].gate) {
+			voiceNoteOff(&synth->voices[v]);
+		}
+	}
+	memset(&synth->note_to_voice, NO_VOICE, sizeof(synth->note_to_voice));
+	synth->note_stack_count = 0;
+}
+
 void synthesizerControllerChange(Synthesizer *synth, uint8_t controller_id, float controller_value) {
 	switch(controller_id) {
 		case 1:		// Modulation Wheel
-			synth->mod_wheel = controller_value;
+			setSmootherTarget(&synth->smoothers[SMOOTH_MOD_WHEEL], controller_value);
+		break;
+		case 5:		// Portamento Time
+			setGlideTime(synth, controller_value * 4095.0f);
+		break;
+		case 6:		// Data Entry MSB
+			setRegisteredParameter(synth, controller_value);
 		break;
 		case 7:		// Channel Volume
 			synth->chn_vol = controller_value;			// Not Implemented
@@ -139,6 +310,39 @@ void synthesizerControllerChange(Synthesizer *synth, uint8_t controller_id, floa
 		case 64:	// Sustain Pedal
 			synth->sustain_pedal = controller_value;	// Not Implemented
 		break;
+		case 65:	// Portamento On/Off
+			setGlideMode(synth, controller_value >= 0.5f ? GLIDE_ALWAYS : GLIDE_OFF);
+		break;
+		case 68:	// Legato Footswitch
+			setGlideMode(synth, controller_value >= 0.5f ? GLIDE_LEGATO : GLIDE_OFF);
+		break;
+		case 72:	// Release Time
+			setRelease(synth, controller_value * 4095.0f);
+		break;
+		case 73:	// Attack Time
+			setAttack(synth, controller_value * 4095.0f);
+		break;
+		case 75:	// Decay Time
+			setDecay(synth, controller_value * 4095.0f);
+		break;
+		case 79:	// Sustain Level (Sound Controller 10)
+			setSustain(synth, controller_value * 4095.0f);
+		break;
+		case 100:	// RPN LSB
+			synth->rpn_lsb = (uint8_t)(controller_value * 127.0f + 0.5f);
+		break;
+		case 101:	// RPN MSB
+			synth->rpn_msb = (uint8_t)(controller_value * 127.0f + 0.5f);
+		break;
+		case 123:	// All Notes Off
+			synthesizerAllNotesOff(synth);
+		break;
+		case 126:	// Mono Mode On
+			setVoiceMode(synth, VOICE_MODE_MONO_LEGATO);
+		break;
+		case 127:	// Poly Mode On
+			setVoiceMode(synth, VOICE_MODE_POLY);
+		break;
 		default:
 			;
 	}
@@ -180,13 +384,112 @@ void setOctaveOsc2(Synthesizer *synth, uint16_t new_value) {
 }
 
 void setDetuneOsc2(Synthesizer *synth, uint16_t new_value) {
-	synth->detune_osc2 = (new_value*0.000244) * 0.83 + 0.67;		// [0.67 1.5]
+	setSmootherTarget(&synth->smoothers[SMOOTH_DETUNE_OSC2], (new_value*0.000244f) * 0.83f + 0.67f);	// [0.67 1.5]
 }
 void setFilterCutoff(Synthesizer *synth, uint16_t new_value) {
-	synth->filter_cutoff = (new_value*0.000244)*SAMPLE_RATE/2 + 10; // [10 20010]
+	setSmootherTarget(&synth->smoothers[SMOOTH_CUTOFF], (new_value*0.000244f)*synth->sr/2 + 10);	// [10 sr/2+10]
 }
 void setGain(Synthesizer *synth, uint16_t new_value) {
-	synth->gain = (new_value*0.000244);								// [0, 1]
+	setSmootherTarget(&synth->smoothers[SMOOTH_GAIN], new_value*0.000244f);							// [0, 1]
+}
+void setWaveformOsc1(Synthesizer *synth, int waveform) {
+	for(int v = 0; v < NUM_VOICES; v++) {
+		setOscWaveform(&synth->voices[v].osc1, waveform);
+	}
+}
+void setWaveformOsc2(Synthesizer *synth, int waveform) {
+	for(int v = 0; v < NUM_VOICES; v++) {
+		setOscWaveform(&synth->voices[v].osc2, waveform);
+	}
+}
+void setResonance(Synthesizer *synth, uint16_t new_value) {
+	setSmootherTarget(&synth->smoothers[SMOOTH_RESONANCE], new_value);
+}
+void setSaturator(Synthesizer *synth, enum Saturator saturator) {
+	synth->saturator = saturator;
+	for(int v = 0; v < NUM_VOICES; v++) {
+		setFilterSaturator(&synth->voices[v].filter, saturator);
+	}
+}
+void setAttack(Synthesizer *synth, uint16_t new_value) {
+	for(int v = 0; v < NUM_VOICES; v++) {
+		setAdsrAttack(&synth->voices[v].adsr, new_value);
+	}
+}
+void setDecay(Synthesizer *synth, uint16_t new_value) {
+	for(int v = 0; v < NUM_VOICES; v++) {
+		setAdsrDecay(&synth->voices[v].adsr, new_value);
+	}
+}
+void setSustain(Synthesizer *synth, uint16_t new_value) {
+	for(int v = 0; v < NUM_VOICES; v++) {
+		setAdsrSustain(&synth->voices[v].adsr, new_value);
+	}
+}
+void setRelease(Synthesizer *synth, uint16_t new_value) {
+	for(int v = 0; v < NUM_VOICES; v++) {
+		setAdsrRelease(&synth->voices[v].adsr, new_value);
+	}
+}
+void setVoiceMode(Synthesizer *synth, enum VoiceMode voice_mode) {
+	if(synth->voice_mode != voice_mode) {
+		synthesizerAllNotesOff(synth);
+		synth->voice_mode = voice_mode;
+	}
+}
+void setNotePriority(Synthesizer *synth, enum NotePriority note_priority) {
+	synth->note_priority = note_priority;
+}
+void setBendRange(Synthesizer *synth, float semitones) {
+	synth->bend_range = semitones;
+}
+void setGlideMode(Synthesizer *synth, enum GlideMode glide_mode) {
+	synth->glide_mode = glide_mode;
+}
+void setGlideTime(Synthesizer *synth, uint16_t new_value) {		// [GLIDE_MIN_TIME, GLIDE_MAX_TIME], exponential
+	synth->glide_time = GLIDE_MIN_TIME * expf(logf(GLIDE_MAX_TIME / GLIDE_MIN_TIME) * new_value * 0.000244f);
+	updateGlideCoeff(synth);
+}
+void setControlBlockSize(Synthesizer *synth, int block_size) {
+	block_size = block_size < 1 ? 1 : block_size;
+	synth->modulation.block_size = block_size > MAX_CONTROL_BLOCK_SIZE ? MAX_CONTROL_BLOCK_SIZE : block_size;
+	updateGlideCoeff(synth);
+
+	int ramp_steps = DEFAULT_SMOOTHING_TIME * synth->sr / synth->modulation.block_size;
+	for(int p = 0; p < SMOOTH_COUNT; p++) {
+		setSmootherRamp(&synth->smoothers[p], ramp_steps);
+	}
+}
+void setOversampling(Synthesizer *synth, int factor) {
+	for(int v = 0; v < NUM_VOICES; v++) {
+		setVoiceOversampling(&synth->voices[v], synth->sr, factor);
+	}
+	synth->oversampling = synth->voices[0].oversampler.factor;
+}
+
+// Voices from voice_limit on are released and get no new note
+void setVoiceLimit(Synthesizer *synth, int voice_limit) {
+	voice_limit = voice_limit < 1 ? 1 : voice_limit;
+	synth->voice_limit = voice_limit > NUM_VOICES ? NUM_VOICES : voice_limit;
+	for(int v = synth->voice_limit; v < NUM_VOICES; v++) {
+		Voice *voice = &synth->voices[v];
+		if(synth->note_to_voice[voice->group][voice->midi_note] == v) {
+			synth->note_to_voice[voice->group][voice->midi_note] = NO_VOICE;
+		}
+		if(voice->gate) {
+			voiceNoteOff(voice);
+		}
+	}
+}
+
+// Voices first to first + count - 1 (up to voice_limit) for the new notes of a group. The groups
+// may overlap: a keyboard and a sequencer can share all the voices or get their own ones
+void setVoiceGroup(Synthesizer *synth, uint8_t group, int first, int count) {
+	VoiceGroup *voice_group = &synth->groups[group % NUM_VOICE_GROUPS];
+	first = first < 0 ? 0 : (first > NUM_VOICES - 1 ? NUM_VOICES - 1 : first);
+	count = count < 1 ? 1 : (count > NUM_VOICES - first ? NUM_VOICES - first : count);
+	voice_group->first = first;
+	voice_group->count = count;
 }
 
 /* ========== Parameters ==========*/
@@ -200,19 +503,19 @@ void parametersChangedAnalog(Synthesizer *synth, uint16_t* new_values)
 	// Mixer
 	setGainOsc1(&synth->mixer, new_values[3]);
 	setGainOsc2(&synth->mixer, new_values[4]);
-	synth->gain_osc1 = new_values[3] * 0.000244f;
-	synth->gain_osc2 = new_values[4] * 0.000244f;
+	setSmootherTarget(&synth->smoothers[SMOOTH_GAIN_OSC1], new_values[3] * 0.000244f);
+	setSmootherTarget(&synth->smoothers[SMOOTH_GAIN_OSC2], new_values[4] * 0.000244f);
 
 	// LFO
 	setLfoFrequency(&synth->lfo, (new_values[5]*0.000244f)*200+0.05f);
 
 	// Filter
 	setFilterCutoff(synth, new_values[6]);
-	setFilterResonance(&synth->filter, new_values[7]);
+	setResonance(synth, new_values[7]);
 
 	//ADSR
-	setAdsrAttack(&synth->adsr, new_values[8]);
-	setAdsrRelease(&synth->adsr, new_values[9]);
+	setAttack(synth, new_values[8]);
+	setRelease(synth, new_values[9]);
 
 	// Gain
 	new_values[10] = 100;	// Standard value because volume is very high
@@ -226,22 +529,22 @@ void parametersChangedDigital(Synthesizer *synth, uint16_t GPIO_Pin)
 	switch(GPIO_Pin) {
 		// Oscillators
 		case GPIO_PIN_0:
-			setOscWaveform(&synth->osc1, 0);	// SETTARE GLI INPUT DI QUESTI MULTISWITCH SOLO COME RISING E NON COME FALLING DATO CHE VOGLIO CHE LO STATO CAMBI SOLO QUANDO IL SEGNALE SI ALZA E NON QUANDO SI ABBASSA
+			setWaveformOsc1(synth, 0);	// SETTARE GLI INPUT DI QUESTI MULTISWITCH SOLO COME RISING E NON COME FALLING DATO CHE VOGLIO CHE LO STATO CAMBI SOLO QUANDO IL SEGNALE SI ALZA E NON QUANDO SI ABBASSA
 		break;
 		case GPIO_PIN_1:
-			setOscWaveform(&synth->osc1, 1);	// SETTARE GLI INPUT DI QUESTI MULTISWITCH SOLO COME RISING E NON COME FALLING DATO CHE VOGLIO CHE LO STATO CAMBI SOLO QUANDO IL SEGNALE SI ALZA E NON QUANDO SI ABBASSA
+			setWaveformOsc1(synth, 1);	// SETTARE GLI INPUT DI QUESTI MULTISWITCH SOLO COME RISING E NON COME FALLING DATO CHE VOGLIO CHE LO STATO CAMBI SOLO QUANDO IL SEGNALE SI ALZA E NON QUANDO SI ABBASSA
 		break;
 		case GPIO_PIN_2:
-			setOscWaveform(&synth->osc1, 2);	// SETTARE GLI INPUT DI QUESTI MULTISWITCH SOLO COME RISING E NON COME FALLING DATO CHE VOGLIO CHE LO STATO CAMBI SOLO QUANDO IL SEGNALE SI ALZA E NON QUANDO SI ABBASSA
+			setWaveformOsc1(synth, 2);	// SETTARE GLI INPUT DI QUESTI MULTISWITCH SOLO COME RISING E NON COME FALLING DATO CHE VOGLIO CHE LO STATO CAMBI SOLO QUANDO IL SEGNALE SI ALZA E NON QUANDO SI ABBASSA
 		break;
 		case GPIO_PIN_3:
-			setOscWaveform(&synth->osc2, 0);
+			setWaveformOsc2(synth, 0);
 		break;
 		case GPIO_PIN_4:
-			setOscWaveform(&synth->osc2, 1);
+			setWaveformOsc2(synth, 1);
 		break;
 		case GPIO_PIN_5:
-			setOscWaveform(&synth->osc2, 2);
+			setWaveformOsc2(synth, 2);
 		break;
 
 		case GPIO_PIN_6:
@@ -272,6 +575,163 @@ void parametersChangedDigital(Synthesizer *synth, uint16_t GPIO_Pin)
 	}
 }
 
+/* ========== Voice allocation ========== */
+static void polyNoteOn(Synthesizer *synth, uint8_t group, uint8_t midi_note, float velocity) {
+	int v = synth->note_to_voice[group][midi_note];	// Same note played again: retrigger its voice
+	if(v == NO_VOICE) {
+		v = findFreeVoice(synth, &synth->groups[group]);
+	}
+	if(v == NO_VOICE) {
+		v = findVoiceToSteal(synth, &synth->groups[group]);
+	}
+	if(v == NO_VOICE) {
+		return;									// Group beyond voice_limit
+	}
+
+	bool legato = false;
+	for(int i = 0; i < NUM_VOICES; i++) {
+		legato |= synth->voices[i].gate;
+	}
+
+	Voice *voice = &synth->voices[v];
+	if(synth->note_to_voice[voice->group][voice->midi_note] == v) {	// Stolen, maybe from another group
+		synth->note_to_voice[voice->group][voice->midi_note] = NO_VOICE;
+	}
+	voiceNoteOn(voice, midi_note, velocity, synth->voice_age++);
+	startGlide(synth, voice, synth->last_note, legato);
+	voice->group = group;
+	synth->note_to_voice[group][midi_note] = v;
+}
+
+static void polyNoteOff(Synthesizer *synth, uint8_t group, uint8_t midi_note) {
+	int v = synth->note_to_voice[group][midi_note];
+	if(v != NO_VOICE) {
+		voiceNoteOff(&synth->voices[v]);
+		synth->note_to_voice[group][midi_note] = NO_VOICE;
+	}
+}
+
+// Mono legato: only the first note of a phrase triggers the envelope
+static void monoNoteOn(Synthesizer *synth, uint8_t midi_note, float velocity) {
+	Voice *voice = &synth->voices[0];
+	bool legato = (synth->note_stack_count > 0) && voice->gate;
+
+	float from_note = voice->note;
+
+	pushHeldNote(synth, midi_note);
+	uint8_t note = getPriorityNote(synth);
+	if(legato) {
+		voiceSetNote(voice, note);
+	} else {
+		voiceNoteOn(voice, note, velocity, synth->voice_age++);
+	}
+	startGlide(synth, voice, from_note, legato);
+}
+
+static void monoNoteOff(Synthesizer *synth, uint8_t midi_note) {
+	Voice *voice = &synth->voices[0];
+
+	removeHeldNote(synth, midi_note);
+	if(synth->note_stack_count == 0) {
+		if(voice->gate) {
+			voiceNoteOff(voice);
+		}
+	} else {
+		float from_note = voice->note;
+		voiceSetNote(voice, getPriorityNote(synth));	// Back to a note still held
+		startGlide(synth, voice, from_note, true);
+	}
+}
+
+static int findFreeVoice(Synthesizer *synth, VoiceGroup *group) {
+	int end = group->first + group->count;
+	end = end > synth->voice_limit ? synth->voice_limit : end;
+	for(int v = group->first; v < end; v++) {
+		if(!synth->voices[v].active) {
+			return v;
+		}
+	}
+	return NO_VOICE;
+}
+
+// Released voices are stolen before the held ones
+static int findVoiceToSteal(Synthesizer *synth, VoiceGroup *group) {
+	int end = group->first + group->count;
+	end = end > synth->voice_limit ? synth->voice_limit : end;
+	int best = NO_VOICE;
+	for(int pass = 0; pass < 2 && best == NO_VOICE; pass++) {
+		for(int v = group->first; v < end; v++) {
+			Voice *voice = &synth->voices[v];
+			if(pass == 0 && voice->gate) {
+				continue;
+			}
+			if(best == NO_VOICE) {
+				best = v;
+			} else if(synth->voice_steal == VOICE_STEAL_QUIETEST) {
+				if(getVoiceLevel(voice) < getVoiceLevel(&synth->voices[best])) best = v;
+			} else {
+				if((int32_t)(voice->age - synth->voices[best].age) < 0) best = v;
+			}
+		}
+	}
+	return best;
+}
+
+static void pushHeldNote(Synthesizer *synth, uint8_t midi_note) {
+	removeHeldNote(synth, midi_note);
+	if(synth->note_stack_count == NOTE_STACK_SIZE) {	// Full: forget the oldest note
+		memmove(&synth->note_stack[0], &synth->note_stack[1], NOTE_STACK_SIZE - 1);
+		synth->note_stack_count--;
+	}
+	synth->note_stack[synth->note_stack_count++] = midi_note;
+}
+
+static void removeHeldNote(Synthesizer *synth, uint8_t midi_note) {
+	for(int i = 0; i < synth->note_stack_count; i++) {
+		if(synth->note_stack[i] == midi_note) {
+			memmove(&synth->note_stack[i], &synth->note_stack[i + 1], synth->note_stack_count - i - 1);
+			synth->note_stack_count--;
+			return;
+		}
+	}
+}
+
+static uint8_t getPriorityNote(Synthesizer *synth) {
+	uint8_t note = synth->note_stack[synth->note_stack_count - 1];	// Last
+	for(int i = 0; i < synth->note_stack_count; i++) {
+		uint8_t held = synth->note_stack[i];
+		if(synth->note_priority == NOTE_PRIORITY_LOW && held < note) {
+			note = held;
+		} else if(synth->note_priority == NOTE_PRIORITY_HIGH && held > note) {
+			note = held;
+		}
+	}
+	return note;
+}
+
+/* ========== Glide ========== */
+// The voice has its new note: glide to it from from_note if the mode asks so
+static void startGlide(Synthesizer *synth, Voice *voice, float from_note, bool legato) {
+	if(synth->glide_mode == GLIDE_ALWAYS || (synth->glide_mode == GLIDE_LEGATO && legato)) {
+		voiceGlideFrom(voice, from_note);
+	}
+	synth->last_note = voice->target_note;
+}
+
+// Within GLIDE_EPSILON of a 12 semitones jump after glide_time
+static void updateGlideCoeff(Synthesizer *synth) {
+	float control_rate = synth->sr / synth->modulation.block_size;
+	synth->glide_coeff = 1.0f - expf(logf(GLIDE_EPSILON / 12.0f) / (synth->glide_time * control_rate));
+}
+
+/* ========== Registered parameters ========== */
+// Data entry for the RPN selected by CC101/CC100
+static void setRegisteredParameter(Synthesizer *synth, float controller_value) {
+	if(synth->rpn_msb == 0 && synth->rpn_lsb == 0) {	// Pitch bend sensitivity, in semitones
+		setBendRange(synth, (int)(controller_value * 127.0f + 0.5f));
+	}
+}
+
 /* ========== Private function ========== */
 float jmap(float source_value, float source_min, float source_max, float target_min, float target_max) {
 	return target_min + ((target_max - target_min) * (source_value - source_min)) / (source_max - source_min);
@@ -0,0 +1,646 @@
+/**
+  ******************************************************************************
+  * @file    tables.c
+  * @author  Bianchi Davide
+  * @brief   This file contains the read-only tables shared by the dsp components.
+  *          GENERATED by Tools/generate_tables.py: do not edit by hand.
+  ******************************************************************************
+**/
+
+#include "dsp/tables.h"
+
+/* ========== BLIT ========== */
+/* Band-limited impulses, one row every 1/256 of sample */
+const float blit_table[256][16] = {
+	{-0.000467743535f, 0.00210792894f, -0.00825028373f, 0.0205299917f, -0.0385980718f, 0.0598740957f, -0.0801228139f, 0.0946940897f, 0.89999787f, 0.0946940897f, -0.0801228139f, 0.0598740957f, -0.0385980718f, 0.0205299917f, -0.00825028373f, 0.00210792894f},
+	{-0.000474610581f, 0.00211290408f, -0.00824718443f, 0.0204686981f, -0.0383633292f, 0.05925411f, -0.0786977914f, 0.0910869853f, 0.899985292f, 0.0983210324f, -0.081546172f, 0.060490136f, -0.0388295047f, 0.0205891877f, -0.00825234302f, 0.0021025895f},
+	{-0.000481441366f, 0.00211748942f, -0.00824294055f, 0.0204050456f, -0.0381247915f, 0.0586294461f, -0.0772701681f, 0.0874985608f, 0.899935172f, 0.101966364f, -0.0829665961f, 0.0611013154f, -0.0390570509f, 0.0206459828f, -0.00825323987f, 0.00209685324f},
+	{-0.000488236285f, 0.00212168845f, -0.00823756118f, 0.0203390562f, -0.0378825081f, 0.0580002043f, -0.0758401292f, 0.0839290091f, 0.899847512f, 0.105629885f, -0.0843838991f, 0.0617075339f, -0.0392806617f, 0.0207003552f, -0.00825296547f, 0.00209071678f},
+	{-0.000494995723f, 0.00212550469f, -0.00823105557f, 0.0202707523f, -0.0376365287f, 0.0573664846f, -0.0744078595f, 0.0803785212f, 0.899722321f, 0.109311396f, -0.0857978933f, 0.0623086922f, -0.0395002887f, 0.0207522838f, -0.00825151113f, 0.00208417677f},
+	{-0.000501720045f, 0.00212894168f, -0.00822343304f, 0.0202001564f, -0.0373869032f, 0.0567283875f, -0.0729735428f, 0.0768472857f, 0.899559608f, 0.113010695f, -0.0872083905f, 0.0629046906f, -0.0397158838f, 0.0208017473f, -0.0082488683f, 0.00207722989f},
+	{-0.000508409606f, 0.00213200302f, -0.00821470304f, 0.0201272912f, -0.0371336818f, 0.0560860134f, -0.0715373626f, 0.0733354892f, 0.899359385f, 0.116727577f, -0.088615202f, 0.0634954302f, -0.0399273992f, 0.0208487249f, -0.00824502854f, 0.00206987288f},
+	{-0.000515064742f, 0.00213469233f, -0.00820487511f, 0.0200521797f, -0.0368769147f, 0.0554394629f, -0.0700995016f, 0.0698433162f, 0.899121668f, 0.120461836f, -0.0900181386f, 0.0640808119f, -0.0401347875f, 0.020893196f, -0.00823998353f, 0.00206210252f},
+	{-0.000521685776f, 0.00213701325f, -0.00819395891f, 0.019974845f, -0.0366166528f, 0.0547888364f, -0.0686601418f, 0.066370949f, 0.898846476f, 0.124213264f, -0.0914170106f, 0.0646607369f, -0.0403380015f, 0.0209351401f, -0.0082337251f, 0.00205391561f},
+	{-0.000528273011f, 0.00213896946f, -0.0081819642f, 0.0198953104f, -0.0363529467f, 0.0541342349f, -0.0672194645f, 0.062918568f, 0.898533829f, 0.127981651f, -0.0928116278f, 0.0652351067f, -0.0405369944f, 0.020974537f, -0.00822624518f, 0.00204530903f},
+	{-0.000534826738f, 0.00214056467f, -0.00816890081f, 0.0198135993f, -0.0360858477f, 0.0534757588f, -0.0657776503f, 0.0594863511f, 0.898183753f, 0.131766784f, -0.0942017996f, 0.0658038232f, -0.0407317198f, 0.021011367f, -0.00821753587f, 0.00203627966f},
+	{-0.000541347229f, 0.00214180261f, -0.0081547787f, 0.0197297355f, -0.0358154069f, 0.0528135092f, -0.0643348789f, 0.0560744743f, 0.897796273f, 0.13556845f, -0.095587335f, 0.0663667883f, -0.0409221315f, 0.0210456102f, -0.00820758939f, 0.00202682448f},
+	{-0.000547834739f, 0.00214268704f, -0.00813960792f, 0.0196437427f, -0.0355416758f, 0.0521475867f, -0.0628913296f, 0.0526831111f, 0.89737142f, 0.139386433f, -0.0969680424f, 0.0669239044f, -0.0411081837f, 0.0210772473f, -0.00819639807f, 0.00201694047f},
+	{-0.000554289506f, 0.00214322176f, -0.0081233986f, 0.019555645f, -0.0352647062f, 0.0514780922f, -0.0614471806f, 0.0493124333f, 0.896909227f, 0.143220514f, -0.0983437301f, 0.067475074f, -0.0412898311f, 0.0211062592f, -0.00818395443f, 0.00200662469f},
+	{-0.000560711752f, 0.00214341056f, -0.00810616096f, 0.0194654665f, -0.0349845498f, 0.0508051265f, -0.0600026094f, 0.0459626099f, 0.896409729f, 0.147070474f, -0.0997142058f, 0.0680202002f, -0.0414670285f, 0.0211326269f, -0.0081702511f, 0.00199587423f},
+	{-0.000567101677f, 0.00214325729f, -0.00808790532f, 0.0193732316f, -0.0347012588f, 0.0501287904f, -0.0585577928f, 0.0426338083f, 0.895872964f, 0.150936092f, -0.101079277f, 0.0685591861f, -0.0416397314f, 0.0211563319f, -0.00815528085f, 0.00198468623f},
+	{-0.000573459468f, 0.00214276579f, -0.00806864207f, 0.0192789646f, -0.0344148853f, 0.0494491848f, -0.0571129068f, 0.0393261931f, 0.895298975f, 0.154817143f, -0.10243875f, 0.0690919353f, -0.0418078955f, 0.0211773558f, -0.00813903661f, 0.00197305791f},
+	{-0.00057978529f, 0.00214193996f, -0.0080483817f, 0.0191826903f, -0.0341254816f, 0.0487664103f, -0.0556681263f, 0.0360399271f, 0.894687806f, 0.158713404f, -0.103792433f, 0.0696183519f, -0.0419714768f, 0.0211956805f, -0.00812151147f, 0.0019609865f},
+	{-0.000586079291f, 0.00214078368f, -0.00802713476f, 0.0190844334f, -0.0338331004f, 0.0480805678f, -0.0542236256f, 0.0327751707f, 0.894039503f, 0.162624646f, -0.105140132f, 0.07013834f, -0.0421304319f, 0.0212112882f, -0.00810269863f, 0.00194846932f},
+	{-0.000592341598f, 0.00213930088f, -0.0080049119f, 0.0189842189f, -0.0335377942f, 0.0473917578f, -0.0527795781f, 0.0295320819f, 0.893354117f, 0.166550641f, -0.106481652f, 0.0706518044f, -0.0422847177f, 0.0212241615f, -0.00808259147f, 0.00193550373f},
+	{-0.000598572323f, 0.00213749548f, -0.00798172384f, 0.0188820718f, -0.033239616f, 0.046700081f, -0.0513361563f, 0.0263108166f, 0.8926317f, 0.170491158f, -0.1078168f, 0.0711586501f, -0.0424342915f, 0.0212342831f, -0.00806118354f, 0.00192208713f},
+	{-0.000604771554f, 0.00213537145f, -0.00795758136f, 0.0187780172f, -0.0329386185f, 0.0460056378f, -0.0498935317f, 0.0231115285f, 0.891872308f, 0.174445965f, -0.109145381f, 0.0716587826f, -0.0425791111f, 0.0212416361f, -0.0080384685f, 0.00190821701f},
+	{-0.000610939362f, 0.00213293275f, -0.00793249534f, 0.0186720805f, -0.032634855f, 0.0453085287f, -0.0484518751f, 0.0199343689f, 0.891076f, 0.178414827f, -0.110467201f, 0.0721521079f, -0.0427191347f, 0.0212462039f, -0.00801444021f, 0.00189389088f},
+	{-0.000617075798f, 0.00213018337f, -0.0079064767f, 0.0185642872f, -0.0323283785f, 0.044608854f, -0.0470113562f, 0.0167794867f, 0.890242837f, 0.18239751f, -0.111782066f, 0.0726385322f, -0.0428543208f, 0.0212479702f, -0.00798909266f, 0.00187910635f},
+	{-0.000623180892f, 0.0021271273f, -0.00787953645f, 0.0184546628f, -0.0320192425f, 0.0439067138f, -0.0455721439f, 0.0136470288f, 0.889372882f, 0.186393774f, -0.113089779f, 0.0731179623f, -0.0429846287f, 0.0212469189f, -0.00796242003f, 0.00186386106f},
+	{-0.000629254654f, 0.00212376857f, -0.00785168565f, 0.018343233f, -0.0317075001f, 0.0432022082f, -0.044134406f, 0.0105371394f, 0.888466204f, 0.190403381f, -0.114390146f, 0.0735903054f, -0.0431100177f, 0.0212430342f, -0.00793441664f, 0.00184815271f},
+	{-0.000635297075f, 0.00212011118f, -0.00782293543f, 0.0182300235f, -0.0313932051f, 0.0424954372f, -0.0426983094f, 0.00744996082f, 0.887522871f, 0.194426091f, -0.115682972f, 0.0740554692f, -0.0432304479f, 0.0212363009f, -0.00790507699f, 0.00183197909f},
+	{-0.000641308123f, 0.00211615919f, -0.00779329699f, 0.0181150604f, -0.0310764109f, 0.0417865004f, -0.04126402f, 0.00438563269f, 0.886542957f, 0.198461659f, -0.116968061f, 0.074513362f, -0.0433458797f, 0.0212267038f, -0.00787439574f, 0.00181533801f},
+	{-0.000647287747f, 0.00211191663f, -0.00776278157f, 0.0179983695f, -0.0307571711f, 0.0410754974f, -0.0398317029f, 0.00134429249f, 0.885526536f, 0.202509843f, -0.118245218f, 0.0749638923f, -0.043456274f, 0.0212142282f, -0.00784236772f, 0.00179822739f},
+	{-0.000653235875f, 0.00210738756f, -0.00773140049f, 0.017879977f, -0.0304355396f, 0.0403625277f, -0.0384015219f, -0.00167392467f, 0.884473687f, 0.206570396f, -0.119514247f, 0.0754069694f, -0.0435615922f, 0.0211988595f, -0.00780898794f, 0.00178064518f},
+	{-0.000659152412f, 0.00210257604f, -0.00769916509f, 0.017759909f, -0.03011157f, 0.0396476905f, -0.0369736399f, -0.00466888605f, 0.883384491f, 0.210643071f, -0.120774953f, 0.075842503f, -0.0436617963f, 0.0211805837f, -0.00777425158f, 0.0017625894f},
+	{-0.000665037245f, 0.00209748616f, -0.0076660868f, 0.017638192f, -0.0297853163f, 0.0389310849f, -0.0355482188f, -0.00764046124f, 0.882259032f, 0.214727619f, -0.122027139f, 0.0762704033f, -0.0437568486f, 0.021159387f, -0.00773815398f, 0.00174405817f},
+	{-0.000670890235f, 0.00209212198f, -0.00763217707f, 0.0175148522f, -0.0294568323f, 0.0382128095f, -0.0341254194f, -0.0105885222f, 0.881097395f, 0.218823789f, -0.12327061f, 0.0766905812f, -0.043846712f, 0.021135256f, -0.00770069069f, 0.00172504962f},
+	{-0.000676711226f, 0.00208648759f, -0.00759744742f, 0.017389916f, -0.029126172f, 0.037492963f, -0.0327054015f, -0.0135129432f, 0.87989967f, 0.222931329f, -0.124505171f, 0.077102948f, -0.0439313498f, 0.0211081774f, -0.0076618574f, 0.00170556201f},
+	{-0.000682500037f, 0.00208058707f, -0.0075619094f, 0.0172634102f, -0.0287933893f, 0.0367716437f, -0.0312883237f, -0.0164136011f, 0.87866595f, 0.227049986f, -0.125730625f, 0.0775074156f, -0.0440107261f, 0.0210781385f, -0.00762165001f, 0.00168559362f},
+	{-0.000688256468f, 0.00207442453f, -0.00752557462f, 0.0171353611f, -0.0284585382f, 0.0360489498f, -0.0298743438f, -0.0192903748f, 0.877396329f, 0.231179504f, -0.126946777f, 0.0779038966f, -0.0440848052f, 0.021045127f, -0.00758006459f, 0.00166514284f},
+	{-0.000693980294f, 0.00206800405f, -0.00748845471f, 0.0170057956f, -0.0281216728f, 0.0353249791f, -0.028463618f, -0.0221431458f, 0.876090904f, 0.235319627f, -0.128153431f, 0.0782923041f, -0.0441535522f, 0.0210091306f, -0.0075370974f, 0.0016442081f},
+	{-0.00069967127f, 0.00206132974f, -0.00745056135f, 0.0168747404f, -0.027782847f, 0.0345998291f, -0.0270563019f, -0.024971798f, 0.874749775f, 0.239470096f, -0.129350391f, 0.0786725519f, -0.0442169324f, 0.0209701377f, -0.00749274489f, 0.00162278791f},
+	{-0.000705329128f, 0.00205440569f, -0.00741190627f, 0.0167422222f, -0.0274421149f, 0.0338735972f, -0.0256525497f, -0.0277762176f, 0.873373046f, 0.243630653f, -0.130537463f, 0.0790445543f, -0.0442749121f, 0.0209281368f, -0.00744700368f, 0.00160088088f},
+	{-0.000710953579f, 0.002047236f, -0.0073725012f, 0.016608268f, -0.0270995306f, 0.0331463803f, -0.0242525146f, -0.0305562933f, 0.871960822f, 0.247801035f, -0.13171445f, 0.0794082264f, -0.0443274577f, 0.020883117f, -0.00739987059f, 0.00157848565f},
+	{-0.00071654431f, 0.00203982476f, -0.00733235795f, 0.0164729046f, -0.026755148f, 0.0324182752f, -0.0228563484f, -0.0333119161f, 0.870513212f, 0.251980982f, -0.132881157f, 0.0797634839f, -0.0443745365f, 0.0208350676f, -0.00735134264f, 0.00155560098f},
+	{-0.000722100987f, 0.00203217608f, -0.00729148831f, 0.016336159f, -0.0264090212f, 0.0316893783f, -0.0214642021f, -0.0360429794f, 0.869030326f, 0.256170229f, -0.13403739f, 0.0801102431f, -0.0444161162f, 0.0207839783f, -0.00730141703f, 0.00153222567f},
+	{-0.000727623253f, 0.00202429405f, -0.00724990414f, 0.0161980582f, -0.0260612041f, 0.0309597855f, -0.0200762252f, -0.0387493792f, 0.867512278f, 0.260368511f, -0.135182953f, 0.080448421f, -0.044452165f, 0.0207298392f, -0.00725009117f, 0.00150835861f},
+	{-0.000733110727f, 0.00201618275f, -0.00720761731f, 0.0160586293f, -0.0257117507f, 0.0302295927f, -0.0186925662f, -0.0414310138f, 0.865959184f, 0.264575561f, -0.136317652f, 0.0807779353f, -0.044482652f, 0.0206726407f, -0.00719736264f, 0.00148399879f},
+	{-0.00073856301f, 0.00200784627f, -0.0071646397f, 0.0159178994f, -0.0253607149f, 0.0294988953f, -0.0173133724f, -0.0440877838f, 0.864371164f, 0.268791112f, -0.137441291f, 0.0810987046f, -0.0445075465f, 0.0206123736f, -0.00714322925f, 0.00145914524f},
+	{-0.000743979675f, 0.0019992887f, -0.00712098324f, 0.0157758955f, -0.0250081506f, 0.0287677882f, -0.0159387899f, -0.0467195924f, 0.862748339f, 0.273014896f, -0.138553678f, 0.0814106479f, -0.0445268186f, 0.0205490291f, -0.00708768899f, 0.0014337971f},
+	{-0.000749360275f, 0.0019905141f, -0.00707665986f, 0.0156326448f, -0.0246541115f, 0.0280363661f, -0.0145689634f, -0.0493263452f, 0.861090833f, 0.277246641f, -0.139654617f, 0.0817136852f, -0.0445404389f, 0.0204825989f, -0.00703074004f, 0.00140795358f},
+	{-0.000754704342f, 0.00198152655f, -0.00703168151f, 0.0154881745f, -0.0242986515f, 0.0273047234f, -0.0132040366f, -0.0519079501f, 0.859398773f, 0.281486076f, -0.140743915f, 0.0820077371f, -0.0445483788f, 0.0204130748f, -0.00697238082f, 0.00138161396f},
+	{-0.000760011382f, 0.0019723301f, -0.00698606017f, 0.0153425118f, -0.0239418242f, 0.0265729539f, -0.0118441519f, -0.0544643175f, 0.857672289f, 0.285732928f, -0.141821379f, 0.0822927249f, -0.0445506101f, 0.0203404492f, -0.00691260992f, 0.00135477762f},
+	{-0.000765280881f, 0.00196292881f, -0.00693980781f, 0.0151956839f, -0.0235836833f, 0.0258411512f, -0.0104894503f, -0.0569953605f, 0.855911512f, 0.289986923f, -0.142886815f, 0.082568571f, -0.0445471054f, 0.0202647149f, -0.00685142615f, 0.00132744403f},
+	{-0.000770512301f, 0.00195332672f, -0.00689293644f, 0.0150477179f, -0.0232242823f, 0.0251094083f, -0.00914007173f, -0.0595009942f, 0.854116578f, 0.294247787f, -0.14394003f, 0.0828351981f, -0.0445378377f, 0.0201858649f, -0.00678882852f, 0.00129961271f},
+	{-0.000775705082f, 0.00194352786f, -0.00684545805f, 0.0148986412f, -0.0228636746f, 0.024377818f, -0.0077961548f, -0.0619811364f, 0.852287623f, 0.298515243f, -0.144980833f, 0.0830925301f, -0.0445227808f, 0.0201038929f, -0.00672481627f, 0.0012712833f},
+	{-0.000780858641f, 0.00193353626f, -0.00679738467f, 0.0147484809f, -0.0225019136f, 0.0236464726f, -0.0064578368f, -0.0644357073f, 0.850424787f, 0.302789013f, -0.146009031f, 0.0833404916f, -0.0445019091f, 0.0200187928f, -0.00665938881f, 0.00124245551f},
+	{-0.000785972374f, 0.00192335592f, -0.0067487283f, 0.0145972643f, -0.0221390525f, 0.0229154638f, -0.00512525376f, -0.0668646295f, 0.848528214f, 0.307068818f, -0.147024432f, 0.083579008f, -0.0444751976f, 0.0199305589f, -0.0065925458f, 0.00121312914f},
+	{-0.000791045652f, 0.00191299084f, -0.00669950097f, 0.0144450186f, -0.0217751446f, 0.022184883f, -0.00379854038f, -0.0692678282f, 0.846598046f, 0.31135438f, -0.148026845f, 0.0838080053f, -0.0444426221f, 0.0198391858f, -0.00652428709f, 0.00118330408f},
+	{-0.000796077826f, 0.001902445f, -0.00664971471f, 0.014291771f, -0.0214102428f, 0.0214548213f, -0.00247783009f, -0.0716452308f, 0.844634433f, 0.315645417f, -0.14901608f, 0.0840274109f, -0.0444041588f, 0.0197446689f, -0.00645461276f, 0.00115298029f},
+	{-0.000801068223f, 0.00189172239f, -0.00659938154f, 0.0141375488f, -0.0210444002f, 0.020725369f, -0.00116325497f, -0.0739967673f, 0.842637524f, 0.319941648f, -0.149991945f, 0.0842371525f, -0.0443597848f, 0.0196470036f, -0.0063835231f, 0.00112215785f},
+	{-0.000806016148f, 0.00188082694f, -0.00654851347f, 0.013982379f, -0.0206776694f, 0.0199966161f, 0.000145054223f, -0.0763223702f, 0.840607471f, 0.324242789f, -0.150954252f, 0.0844371591f, -0.0443094778f, 0.0195461859f, -0.0063110186f, 0.0010908369f},
+	{-0.000810920885f, 0.00186976261f, -0.00649712253f, 0.013826289f, -0.0203101031f, 0.0192686522f, 0.00144696805f, -0.0786219743f, 0.838544429f, 0.328548557f, -0.151902811f, 0.0846273602f, -0.0442532161f, 0.0194422122f, -0.0062371f, 0.00105901769f},
+	{-0.000815781695f, 0.00185853331f, -0.00644522073f, 0.0136693058f, -0.019941754f, 0.0185415664f, 0.00274235843f, -0.080895517f, 0.836448555f, 0.332858667f, -0.152837432f, 0.0848076866f, -0.0441909788f, 0.0193350794f, -0.00616176823f, 0.00102670056f},
+	{-0.000820597816f, 0.00184714296f, -0.00639282006f, 0.0135114565f, -0.0195726743f, 0.017815447f, 0.00403109865f, -0.0831429381f, 0.83432001f, 0.337172834f, -0.153757929f, 0.0849780696f, -0.0441227455f, 0.0192247845f, -0.00608502445f, 0.000993885926f},
+	{-0.000825368465f, 0.00183559544f, -0.00633993253f, 0.0133527684f, -0.0192029162f, 0.0170903822f, 0.00531306333f, -0.0853641797f, 0.832158955f, 0.341490769f, -0.154664112f, 0.0851384419f, -0.0440484967f, 0.0191113254f, -0.00600687006f, 0.000960574315f},
+	{-0.000830092839f, 0.00182389463f, -0.00628657011f, 0.0131932683f, -0.018832532f, 0.0163664595f, 0.00658812849f, -0.0875591865f, 0.829965555f, 0.345812187f, -0.155555795f, 0.0852887366f, -0.0439682135f, 0.0189947001f, -0.00592730667f, 0.00092676634f},
+	{-0.000834770111f, 0.00181204438f, -0.00623274477f, 0.0130329834f, -0.0184615733f, 0.0156437657f, 0.0078561715f, -0.0897279058f, 0.827739978f, 0.350136799f, -0.156432792f, 0.0854288882f, -0.0438818777f, 0.018874907f, -0.00584633609f, 0.000892462705f},
+	{-0.000839399432f, 0.00180004852f, -0.00617846846f, 0.0128719405f, -0.0180900921f, 0.0149223874f, 0.00911707116f, -0.0918702869f, 0.825482392f, 0.354464314f, -0.157294916f, 0.085558832f, -0.0437894719f, 0.0187519452f, -0.00576396039f, 0.000857664215f},
+	{-0.000843979933f, 0.00178791087f, -0.00612375311f, 0.0127101667f, -0.0177181399f, 0.0142024105f, 0.0103707076f, -0.0939862821f, 0.823192969f, 0.358794444f, -0.158141982f, 0.0856785041f, -0.0436909792f, 0.018625814f, -0.00568018186f, 0.000822371765f},
+	{-0.000848510725f, 0.00177563521f, -0.00606861065f, 0.0125476888f, -0.017345768f, 0.0134839202f, 0.0116169624f, -0.0960758457f, 0.820871884f, 0.363126896f, -0.158973806f, 0.0857878418f, -0.0435863837f, 0.0184965132f, -0.005595003f, 0.00078658635f},
+	{-0.000852990895f, 0.00176322533f, -0.00601305296f, 0.0123845337f, -0.0169730276f, 0.0127670014f, 0.0128557186f, -0.0981389346f, 0.818519313f, 0.367461379f, -0.159790204f, 0.0858867834f, -0.04347567f, 0.0183640431f, -0.00550842656f, 0.000750309059f},
+	{-0.000857419511f, 0.00175068495f, -0.00595709191f, 0.0122207281f, -0.0165999698f, 0.0120517383f, 0.0140868606f, -0.100175508f, 0.816135435f, 0.371797601f, -0.160590993f, 0.0859752681f, -0.0433588235f, 0.0182284043f, -0.0054204555f, 0.000713541081f},
+	{-0.000861795619f, 0.00173801782f, -0.00590073935f, 0.0120562988f, -0.0162266453f, 0.0113382144f, 0.0153102741f, -0.102185528f, 0.813720431f, 0.376135267f, -0.16137599f, 0.0860532361f, -0.0432358303f, 0.0180895981f, -0.00533109302f, 0.0006762837f},
+	{-0.000866118246f, 0.00172522764f, -0.0058440071f, 0.0118912723f, -0.0158531047f, 0.0106265129f, 0.0165258465f, -0.104168959f, 0.811274485f, 0.380474086f, -0.162145014f, 0.0861206287f, -0.0431066775f, 0.0179476259f, -0.00524034256f, 0.0006385383f},
+	{-0.000870386397f, 0.00171231808f, -0.00578690695f, 0.0117256753f, -0.0154793984f, 0.00991671625f, 0.0177334664f, -0.106125767f, 0.808797782f, 0.38481376f, -0.162897884f, 0.0861773884f, -0.0429713526f, 0.0178024899f, -0.00514820778f, 0.000600306365f},
+	{-0.000874599059f, 0.00169929279f, -0.00572945065f, 0.0115595343f, -0.0151055765f, 0.00920890622f, 0.0189330239f, -0.108055922f, 0.806290511f, 0.389153995f, -0.163634419f, 0.0862234584f, -0.0428298439f, 0.0176541925f, -0.00505469257f, 0.000561589478f},
+	{-0.000878755196f, 0.00168615541f, -0.00567164995f, 0.0113928757f, -0.014731689f, 0.00850316409f, 0.0201244107f, -0.109959394f, 0.803752861f, 0.393494496f, -0.164354441f, 0.0862587833f, -0.0426821408f, 0.0175027366f, -0.00495980107f, 0.000522389322f},
+	{-0.000882853755f, 0.00167290954f, -0.00561351653f, 0.0112257258f, -0.0143577856f, 0.00779957048f, 0.0213075198f, -0.111836159f, 0.801185025f, 0.397834965f, -0.165057771f, 0.0862833085f, -0.0425282329f, 0.0173481255f, -0.00486353764f, 0.000482707681f},
+	{-0.000886893662f, 0.00165955874f, -0.00555506205f, 0.0110581111f, -0.0139839158f, 0.00709820539f, 0.0224822457f, -0.113686192f, 0.798587197f, 0.402175105f, -0.165744232f, 0.0862969807f, -0.0423681111f, 0.0171903633f, -0.00476590689f, 0.00044254644f},
+	{-0.000890873825f, 0.00164610659f, -0.00549629814f, 0.0108900576f, -0.0136101288f, 0.0063991482f, 0.0236484844f, -0.115509472f, 0.795959576f, 0.406514618f, -0.166413647f, 0.0862997476f, -0.0422017668f, 0.0170294541f, -0.00466691365f, 0.000401907587f},
+	{-0.000894793131f, 0.00163255658f, -0.00543723638f, 0.0107215915f, -0.0132364736f, 0.00570247764f, 0.0248061333f, -0.11730598f, 0.793302359f, 0.410853206f, -0.16706584f, 0.0862915581f, -0.0420291922f, 0.0168654027f, -0.00456656299f, 0.00036079321f},
+	{-0.00089865045f, 0.00161891223f, -0.00537788832f, 0.0105527387f, -0.0128629989f, 0.0050082718f, 0.0259550914f, -0.1190757f, 0.790615748f, 0.415190571f, -0.167700636f, 0.0862723621f, -0.0418503802f, 0.0166982142f, -0.00446486023f, 0.000319205503f},
+	{-0.000902444632f, 0.00160517699f, -0.00531826546f, 0.0103835253f, -0.0124897531f, 0.0043166081f, 0.0270952591f, -0.120818618f, 0.787899946f, 0.419526412f, -0.168317862f, 0.0862421106f, -0.0416653248f, 0.0165278945f, -0.00436181092f, 0.00027714676f},
+	{-0.00090617451f, 0.00159135431f, -0.00525837925f, 0.010213977f, -0.0121167846f, 0.00362756332f, 0.0282265383f, -0.122534723f, 0.785155159f, 0.42386043f, -0.168917344f, 0.086200756f, -0.0414740203f, 0.0163544496f, -0.00425742085f, 0.000234619382f},
+	{-0.000909838899f, 0.00157744758f, -0.00519824111f, 0.0100441195f, -0.0117441413f, 0.00294121356f, 0.0293488323f, -0.124224004f, 0.782381594f, 0.428192325f, -0.169498911f, 0.0861482516f, -0.0412764623f, 0.0161778861f, -0.00415169605f, 0.000191625871f},
+	{-0.000913436595f, 0.00156346019f, -0.00513786242f, 0.00987397859f, -0.0113718707f, 0.00225763426f, 0.0304620462f, -0.125886456f, 0.779579461f, 0.432521796f, -0.170062392f, 0.086084552f, -0.0410726469f, 0.0159982111f, -0.00404464279f, 0.000148168836f},
+	{-0.000916966378f, 0.00154939549f, -0.00507725448f, 0.00970357963f, -0.0110000204f, 0.00157690016f, 0.0315660863f, -0.127522074f, 0.776748972f, 0.436848542f, -0.170607617f, 0.0860096129f, -0.040862571f, 0.0158154321f, -0.00393626758f, 0.000104250989f},
+	{-0.00092042701f, 0.00153525678f, -0.00501642857f, 0.00953294808f, -0.0106286375f, 0.000899085323f, 0.0326608605f, -0.129130857f, 0.77389034f, 0.441172261f, -0.171134416f, 0.0859233913f, -0.0406462324f, 0.0156295572f, -0.00382657717f, 5.98751501e-05f},
+	{-0.000923817237f, 0.00152104736f, -0.0049553959f, 0.00936210922f, -0.0102577687f, 0.000224263123f, 0.0337462783f, -0.130712803f, 0.771003782f, 0.445492652f, -0.171642623f, 0.0858258452f, -0.0404236297f, 0.0154405948f, -0.00371557856f, 1.50442419e-05f},
+	{-0.000927135787f, 0.00150677049f, -0.00489416765f, 0.00919108824f, -0.00988746056f, -0.000447493774f, 0.0348222505f, -0.132267916f, 0.768089515f, 0.449809413f, -0.172132071f, 0.0857169339f, -0.0401947622f, 0.0152485538f, -0.00360327898f, -3.02387053e-05f},
+	{-0.000930381374f, 0.00149242937f, -0.00483275492f, 0.00901991018f, -0.0095177594f, -0.0011161134f, 0.0358886898f, -0.133796202f, 0.765147759f, 0.454122242f, -0.172602593f, 0.0855966181f, -0.0399596303f, 0.0150534437f, -0.00348968592f, -7.59705548e-05f},
+	{-0.000933552694f, 0.0014780272f, -0.00477116876f, 0.00884859998f, -0.0091487111f, -0.00178152452f, 0.0369455101f, -0.135297667f, 0.762178735f, 0.458430835f, -0.173054026f, 0.0854648595f, -0.0397182349f, 0.0148552744f, -0.00337480708f, -0.000122148064f},
+	{-0.000936648428f, 0.00146356714f, -0.00470942018f, 0.00867718244f, -0.0087803613f, -0.00244365659f, 0.0379926268f, -0.136772322f, 0.759182668f, 0.46273489f, -0.173486207f, 0.0853216211f, -0.0394705778f, 0.0146540563f, -0.00325865044f, -0.000168767882f},
+	{-0.000939667244f, 0.00144905231f, -0.00464752011f, 0.00850568226f, -0.00841275531f, -0.0031024398f, 0.0390299572f, -0.138220179f, 0.756159783f, 0.467034104f, -0.173898972f, 0.0851668671f, -0.0392166618f, 0.0144498001f, -0.00314122421f, -0.000215826551f},
+	{-0.000942607792f, 0.0014344858f, -0.00458547944f, 0.00833412398f, -0.00804593812f, -0.00375780509f, 0.0400574197f, -0.139641251f, 0.753110308f, 0.471328174f, -0.174292162f, 0.0850005632f, -0.0389564904f, 0.0142425173f, -0.00302253683f, -0.000263320508f},
+	{-0.000945468709f, 0.00141987066f, -0.00452330897f, 0.00816253201f, -0.00767995441f, -0.0044096841f, 0.0410749345f, -0.141035556f, 0.750034471f, 0.475616796f, -0.174665616f, 0.084822676f, -0.0386900679f, 0.0140322196f, -0.00290259701f, -0.000311246079f},
+	{-0.000948248618f, 0.00140520992f, -0.00446101948f, 0.00799093063f, -0.00731484852f, -0.00505800925f, 0.0420824232f, -0.142403114f, 0.746932505f, 0.479899667f, -0.175019177f, 0.0846331736f, -0.0384173995f, 0.0138189192f, -0.00278141367f, -0.000359599484f},
+	{-0.000950946128f, 0.00139050655f, -0.00439862164f, 0.00781934399f, -0.00695066448f, -0.00570271367f, 0.0430798092f, -0.143743945f, 0.743804643f, 0.484176483f, -0.175352686f, 0.0844320254f, -0.0381384912f, 0.0136026291f, -0.00265899601f, -0.000408376834f},
+	{-0.000953559835f, 0.00137576352f, -0.00433612608f, 0.00764779607f, -0.00658744596f, -0.00634373128f, 0.0440670171f, -0.145058073f, 0.74065112f, 0.488446941f, -0.175665988f, 0.084219202f, -0.0378533499f, 0.0133833623f, -0.00253535344f, -0.000457574132f},
+	{-0.000956088323f, 0.00136098374f, -0.00427354336f, 0.00747631073f, -0.00622523631f, -0.00698099672f, 0.0450439732f, -0.146345524f, 0.737472172f, 0.492710736f, -0.175958929f, 0.0839946755f, -0.0375619833f, 0.0131611326f, -0.00241049565f, -0.000507187273f},
+	{-0.00095853016f, 0.00134617008f, -0.00421088398f, 0.00730491167f, -0.00586407853f, -0.00761444542f, 0.0460106055f, -0.147606327f, 0.734268037f, 0.496967566f, -0.176231354f, 0.0837584189f, -0.0372644f, 0.0129359543f, -0.00228443255f, -0.000557212042f},
+	{-0.000960883905f, 0.00133132539f, -0.00414815834f, 0.00713362245f, -0.00550401528f, -0.00824401356f, 0.0469668434f, -0.148840513f, 0.731038958f, 0.501217126f, -0.176483112f, 0.083510407f, -0.0369606094f, 0.0127078419f, -0.0021571743f, -0.000607644116f},
+	{-0.000963148104f, 0.00131645249f, -0.00408537681f, 0.00696246646f, -0.00514508884f, -0.00886963812f, 0.0479126178f, -0.150048114f, 0.727785174f, 0.505459113f, -0.176714053f, 0.0832506157f, -0.0366506219f, 0.0124768107f, -0.0020287313f, -0.000658479064f},
+	{-0.000965321292f, 0.00130155413f, -0.00402254966f, 0.00679146695f, -0.00478734117f, -0.00949125682f, 0.0488478612f, -0.151229165f, 0.724506931f, 0.509693223f, -0.176924027f, 0.0829790222f, -0.0363344484f, 0.0122428762f, -0.0018991142f, -0.000709712345f},
+	{-0.000967401993f, 0.00128663306f, -0.0039596871f, 0.00662064701f, -0.00443081384f, -0.0101088082f, 0.0497725078f, -0.152383704f, 0.721204474f, 0.513919153f, -0.177112885f, 0.0826956051f, -0.036012101f, 0.0120060547f, -0.0017683339f, -0.000761339308f},
+	{-0.000969388721f, 0.00127169198f, -0.00389679925f, 0.00645002955f, -0.00407554808f, -0.0107222315f, 0.0506864931f, -0.153511771f, 0.717878049f, 0.518136599f, -0.177280483f, 0.0824003445f, -0.0356835927f, 0.0117663627f, -0.00163640152f, -0.000813355196f},
+	{-0.000971279978f, 0.00125673354f, -0.00383389617f, 0.00627963735f, -0.00372158474f, -0.011331467f, 0.0515897545f, -0.154613407f, 0.714527907f, 0.522345258f, -0.177426674f, 0.0820932217f, -0.035348937f, 0.0115238174f, -0.00150332846f, -0.00086575514f},
+	{-0.000973074259f, 0.00124176036f, -0.00377098785f, 0.006109493f, -0.00336896429f, -0.0119364554f, 0.0524822306f, -0.155688657f, 0.711154297f, 0.526544826f, -0.177551315f, 0.0817742193f, -0.0350081486f, 0.0112784362f, -0.00136912632f, -0.000918534164f},
+	{-0.000974770048f, 0.00122677504f, -0.00370808417f, 0.00593961892f, -0.00301772685f, -0.0125371384f, 0.0533638618f, -0.156737567f, 0.707757471f, 0.530735002f, -0.177654264f, 0.0814433216f, -0.0346612429f, 0.0110302373f, -0.00123380699f, -0.00097168718f},
+	{-0.00097636582f, 0.00121178012f, -0.00364519497f, 0.00577003738f, -0.00266791212f, -0.0131334586f, 0.05423459f, -0.157760186f, 0.704337683f, 0.534915481f, -0.17773538f, 0.0811005139f, -0.0343082364f, 0.0107792392f, -0.00109738256f, -0.00102520899f},
+	{-0.000977860043f, 0.00119677811f, -0.00358232999f, 0.00560077046f, -0.00231955946f, -0.0137253593f, 0.0550943586f, -0.158756564f, 0.700895189f, 0.539085962f, -0.177794524f, 0.0807457833f, -0.0339491461f, 0.0105254609f, -0.00095986539f, -0.0010790943f},
+	{-0.000979251177f, 0.00118177148f, -0.00351949888f, 0.00543184006f, -0.00197270782f, -0.0143127846f, 0.0559431127f, -0.159726755f, 0.697430244f, 0.543246143f, -0.177831559f, 0.0803791179f, -0.0335839902f, 0.010268922f, -0.000821268069f, -0.00113333769f},
+	{-0.000980537673f, 0.00116676267f, -0.00345671123f, 0.00526326792f, -0.00162739576f, -0.0148956794f, 0.0567807989f, -0.160670813f, 0.693943108f, 0.547395722f, -0.177846348f, 0.0800005076f, -0.0332127875f, 0.0100096423f, -0.000681603431f, -0.00118793364f},
+	{-0.000981717977f, 0.00115175406f, -0.00339397653f, 0.0050950756f, -0.00128366145f, -0.0154739895f, 0.0576073652f, -0.161588796f, 0.690434041f, 0.551534397f, -0.177838758f, 0.0796099434f, -0.0328355581f, 0.00974764242f, -0.000540884551f, -0.00124287651f},
+	{-0.000982790527f, 0.00113674803f, -0.0033313042f, 0.00492728446f, -0.000941542662f, -0.0160476614f, 0.0584227614f, -0.162480764f, 0.686903302f, 0.555661867f, -0.177808654f, 0.079207418f, -0.0324523225f, 0.00948294326f, -0.000399124744f, -0.00129816058f},
+	{-0.000983753758f, 0.00112174687f, -0.00326870355f, 0.00475991569f, -0.000601076771f, -0.0166166426f, 0.0592269388f, -0.163346777f, 0.683351156f, 0.559777831f, -0.177755907f, 0.0787929254f, -0.0320631023f, 0.00921556626f, -0.000256337565f, -0.00135377999f},
+	{-0.000984606094f, 0.00110675287f, -0.00320618383f, 0.00459299028f, -0.000262300744f, -0.0171808813f, 0.0600198502f, -0.164186901f, 0.679777867f, 0.56388199f, -0.177680385f, 0.0783664609f, -0.0316679201f, 0.00894553333f, -0.000112536806f, -0.00140972878f},
+	{-0.00098534596f, 0.00109176828f, -0.0031437542f, 0.00442652907f, 7.47488559e-05f, -0.0177403265f, 0.06080145f, -0.1650012f, 0.676183699f, 0.567974042f, -0.177581962f, 0.0779280216f, -0.0312667991f, 0.00867286687f, 3.22634991e-05f, -0.00146600089f},
+	{-0.000985971773f, 0.00107679529f, -0.00308142371f, 0.00426055265f, 0.000410035877f, -0.0182949282f, 0.0615716942f, -0.165789743f, 0.67256892f, 0.572053689f, -0.177460511f, 0.0774776058f, -0.0308597637f, 0.00839758973f, 0.000178049081f, -0.00152259016f},
+	{-0.000986481948f, 0.00106183605f, -0.00301920135f, 0.00409508147f, 0.000743524581f, -0.0188446371f, 0.0623305402f, -0.166552601f, 0.668933798f, 0.576120632f, -0.177315906f, 0.0770152134f, -0.030446839f, 0.00811972527f, 0.000324805434f, -0.0015794903f},
+	{-0.000986874893f, 0.00104689271f, -0.002957096f, 0.00393013576f, 0.00107517964f, -0.0193894047f, 0.0630779472f, -0.167289844f, 0.665278603f, 0.580174572f, -0.177148026f, 0.0765408456f, -0.0300280509f, 0.00783929731f, 0.000472517813f, -0.00163669492f},
+	{-0.000987149018f, 0.00103196732f, -0.00289511646f, 0.00376573557f, 0.00140496616f, -0.0199291835f, 0.0638138757f, -0.168001547f, 0.661603605f, 0.584215211f, -0.176956748f, 0.0760545053f, -0.0296034264f, 0.00755633015f, 0.000621171241f, -0.00169419754f},
+	{-0.000987302726f, 0.00101706195f, -0.00283327142f, 0.00360190072f, 0.00173284965f, -0.0204639268f, 0.064538288f, -0.168687787f, 0.657909078f, 0.588242253f, -0.176741954f, 0.0755561967f, -0.0291729932f, 0.00727084857f, 0.000770750505f, -0.00175199155f},
+	{-0.000987334422f, 0.00100217859f, -0.00277156951f, 0.00343865087f, 0.00205879606f, -0.0209935887f, 0.0652511478f, -0.169348642f, 0.654195294f, 0.5922554f, -0.176503525f, 0.0750459255f, -0.0287367801f, 0.00698287783f, 0.000921240159f, -0.00181007025f},
+	{-0.000987242507f, 0.000987319206f, -0.00271001924f, 0.00327600545f, 0.00238277174f, -0.0215181241f, 0.0659524203f, -0.169984193f, 0.650462527f, 0.596254356f, -0.176241346f, 0.0745236991f, -0.0282948165f, 0.00669244363f, 0.00107262452f, -0.00186842682f},
+	{-0.000987025381f, 0.000972485725f, -0.00264862904f, 0.00311398371f, 0.00270474351f, -0.0220374889f, 0.0666420725f, -0.170594522f, 0.646711055f, 0.600238827f, -0.175955301f, 0.0739895263f, -0.027847133f, 0.00639957219f, 0.00122488769f, -0.00192705435f},
+	{-0.000986681445f, 0.000957680032f, -0.00258740724f, 0.00295260467f, 0.0030246786f, -0.0225516398f, 0.0673200727f, -0.171179713f, 0.642941154f, 0.604208517f, -0.175645279f, 0.0734434172f, -0.0273937608f, 0.00610429017f, 0.00137801351f, -0.00198594581f},
+	{-0.0009862091f, 0.000942903973f, -0.00252636207f, 0.00279188716f, 0.00334254466f, -0.0230605343f, 0.0679863908f, -0.171739853f, 0.639153102f, 0.608163132f, -0.175311169f, 0.0728853838f, -0.0269347323f, 0.00580662469f, 0.00153198562f, -0.00204509408f},
+	{-0.000985606748f, 0.000928159355f, -0.00246550167f, 0.00263184979f, 0.00365830981f, -0.0235641308f, 0.0686409983f, -0.172275031f, 0.635347179f, 0.612102379f, -0.174952863f, 0.0723154392f, -0.0264700804f, 0.00550660338f, 0.00168678742f, -0.00210449192f},
+	{-0.00098487279f, 0.000913447945f, -0.00240483408f, 0.00247251098f, 0.00397194258f, -0.0240623886f, 0.0692838682f, -0.172785336f, 0.631523665f, 0.616025966f, -0.174570252f, 0.0717335984f, -0.0259998393f, 0.00520425429f, 0.00184240209f, -0.002164132f},
+	{-0.000984005631f, 0.000898771471f, -0.00234436725f, 0.00231388891f, 0.00428341196f, -0.0245552679f, 0.069914975f, -0.173270862f, 0.627682842f, 0.619933601f, -0.174163233f, 0.0711398776f, -0.0255240437f, 0.00489960596f, 0.00199881256f, -0.00222400689f},
+	{-0.000983003679f, 0.000884131621f, -0.00228410903f, 0.00215600157f, 0.00459268739f, -0.0250427295f, 0.0705342949f, -0.173731702f, 0.623824992f, 0.623824992f, -0.173731702f, 0.0705342949f, -0.0250427295f, 0.00459268739f, 0.00215600157f, -0.00228410903f},
+	{-0.000981865342f, 0.000869530046f, -0.00222406716f, 0.00199886673f, 0.00489973873f, -0.0255247354f, 0.0711418054f, -0.174167953f, 0.6199504f, 0.627699852f, -0.173275557f, 0.0699168696f, -0.0245559333f, 0.00428352804f, 0.00231395161f, -0.00234443078f},
+	{-0.000980589035f, 0.000854968355f, -0.00216424928f, 0.00184250193f, 0.00520453632f, -0.0260012483f, 0.0717374858f, -0.174579713f, 0.616059349f, 0.631557889f, -0.1727947f, 0.0692876228f, -0.0240636926f, 0.00397215783f, 0.00247264497f, -0.0024049644f},
+	{-0.000979173175f, 0.00084044812f, -0.00210466296f, 0.00168692451f, 0.00550705091f, -0.0264722317f, 0.0723213165f, -0.174967082f, 0.612152126f, 0.635398816f, -0.172289032f, 0.0686465769f, -0.023566046f, 0.00365860713f, 0.00263206369f, -0.00246570205f},
+	{-0.000977616182f, 0.000825970872f, -0.00204531563f, 0.00153215159f, 0.00580725376f, -0.0269376503f, 0.0728932798f, -0.175330162f, 0.608229017f, 0.639222345f, -0.171758459f, 0.0679937561f, -0.0230630326f, 0.00334290678f, 0.00279218962f, -0.00252663576f},
+	{-0.000975916485f, 0.000811538106f, -0.00198621465f, 0.00137820006f, 0.00610511652f, -0.0273974692f, 0.0734533595f, -0.175669057f, 0.60429031f, 0.643028191f, -0.171202886f, 0.067329186f, -0.0225546927f, 0.00302508806f, 0.00295300437f, -0.0025877575f},
+	{-0.000974072516f, 0.000797151275f, -0.00192736726f, 0.00122508658f, 0.00640061135f, -0.0278516548f, 0.0740015407f, -0.175983873f, 0.600336293f, 0.646816068f, -0.170622223f, 0.0666528938f, -0.0220410673f, 0.00270518271f, 0.00311448936f, -0.00264905913f},
+	{-0.000972082714f, 0.000782811796f, -0.0018687806f, 0.00107282762f, 0.00669371083f, -0.0283001741f, 0.07453781f, -0.176274716f, 0.596367256f, 0.650585691f, -0.170016379f, 0.0659649083f, -0.0215221985f, 0.00238322292f, 0.00327662576f, -0.00271053238f},
+	{-0.000969945525f, 0.000768521047f, -0.00181046172f, 0.000921439397f, 0.00698438803f, -0.028742995f, 0.0750621558f, -0.176541698f, 0.592383488f, 0.654336778f, -0.169385268f, 0.0652652598f, -0.020998129f, 0.00205924132f, 0.00343939455f, -0.00277216892f},
+	{-0.000967659402f, 0.000754280365f, -0.00175241754f, 0.00077093791f, 0.00727261645f, -0.0291800865f, 0.0755745678f, -0.176784928f, 0.588385281f, 0.658069045f, -0.168728803f, 0.0645539802f, -0.0204689025f, 0.00173327099f, 0.00360277651f, -0.00283396032f},
+	{-0.000965222807f, 0.000740091052f, -0.00169465491f, 0.000621338934f, 0.00755837007f, -0.0296114182f, 0.0760750371f, -0.17700452f, 0.584372927f, 0.661782213f, -0.168046901f, 0.063831103f, -0.0199345636f, 0.00140534545f, 0.00376675217f, -0.00289589803f},
+	{-0.000962634209f, 0.00072595437f, -0.00163718056f, 0.000472658016f, 0.00784162335f, -0.0300369607f, 0.0765635565f, -0.177200588f, 0.580346719f, 0.665476001f, -0.167339481f, 0.0630966634f, -0.0193951578f, 0.00107549867f, 0.0039313019f, -0.00295797342f},
+	{-0.000959892088f, 0.000711871545f, -0.00158000111f, 0.000324910475f, 0.00812235118f, -0.0304566855f, 0.07704012f, -0.17737325f, 0.576306949f, 0.669150131f, -0.166606463f, 0.0623506978f, -0.0188507314f, 0.000743765036f, 0.00409640582f, -0.00302017776f},
+	{-0.000956994932f, 0.000697843764f, -0.00152312308f, 0.0001781114f, 0.00840052894f, -0.0308705649f, 0.0775047235f, -0.177522623f, 0.572253912f, 0.672804323f, -0.165847771f, 0.0615932447f, -0.0183013315f, 0.000410179393f, 0.00426204387f, -0.00308250223f},
+	{-0.00095394124f, 0.000683872175f, -0.00146655289f, 3.22756474e-05f, 0.00867613247f, -0.0312785721f, 0.077957364f, -0.177648827f, 0.568187902f, 0.676438303f, -0.165063329f, 0.0608243437f, -0.0177470063f, 7.47770012e-05f, 0.00442819579f, -0.00314493792f},
+	{-0.000950729523f, 0.000669957892f, -0.00141029685f, -0.000112582155f, 0.0089491381f, -0.0316806812f, 0.0783980401f, -0.177751985f, 0.564109216f, 0.680051795f, -0.164253063f, 0.0600440363f, -0.0171878046f, -0.000262406443f, 0.00459484111f, -0.00320747582f},
+	{-0.000947358301f, 0.000656101989f, -0.00135436118f, -0.000256447613f, 0.00921952259f, -0.0320768673f, 0.0788267518f, -0.177832219f, 0.560018149f, 0.683644525f, -0.163416904f, 0.0592523655f, -0.0166237763f, -0.000601334818f, 0.00476195916f, -0.00327010683f},
+	{-0.00094382611f, 0.000642305505f, -0.00129875195f, -0.000399306565f, 0.0094872632f, -0.0324671061f, 0.0792435008f, -0.177889655f, 0.555914998f, 0.68721622f, -0.162554781f, 0.0584493758f, -0.0160549719f, -0.000941971581f, 0.00492952907f, -0.00333282177f},
+	{-0.000940131493f, 0.000628569441f, -0.00124347518f, -0.000541145085f, 0.00975233766f, -0.0328513743f, 0.0796482899f, -0.177924419f, 0.55180006f, 0.690766609f, -0.16166663f, 0.0576351135f, -0.015481443f, -0.00128427976f, 0.00509752979f, -0.00339561134f},
+	{-0.000936273012f, 0.000614894762f, -0.00118853675f, -0.00068194948f, 0.0100147242f, -0.0332296496f, 0.0800411237f, -0.177936641f, 0.547673634f, 0.694295422f, -0.160752385f, 0.0568096264f, -0.0149032419f, -0.00162822199f, 0.00526594007f, -0.0034584662f},
+	{-0.000932249239f, 0.000601282398f, -0.00113394243f, -0.000821706294f, 0.0102744014f, -0.0336019104f, 0.0804220078f, -0.177926449f, 0.543536017f, 0.69780239f, -0.159811984f, 0.0559729637f, -0.0143204219f, -0.00197376045f, 0.00543473846f, -0.00352137687f},
+	{-0.000928058762f, 0.00058773324f, -0.00107969791f, -0.000960402307f, 0.0105313485f, -0.0339681361f, 0.0807909497f, -0.177893976f, 0.539387509f, 0.701287246f, -0.158845367f, 0.0551251765f, -0.0137330368f, -0.00232085695f, 0.00560390334f, -0.00358433382f},
+	{-0.000923700184f, 0.000574248147f, -0.00102580875f, -0.00109802453f, 0.0107855451f, -0.0343283068f, 0.0811479581f, -0.177839356f, 0.535228409f, 0.704749724f, -0.157852476f, 0.0542663175f, -0.0131411418f, -0.00266947286f, 0.00577341288f, -0.00364732743f},
+	{-0.000919172123f, 0.000560827941f, -0.000972280398f, -0.00123456023f, 0.0110369713f, -0.0346824037f, 0.081493043f, -0.177762722f, 0.531059017f, 0.708189559f, -0.156833256f, 0.0533964406f, -0.0125447924f, -0.00301956918f, 0.00594324508f, -0.00371034797f},
+	{-0.000914473212f, 0.000547473408f, -0.00091911822f, -0.00136999689f, 0.0112856077f, -0.0350304088f, 0.081826216f, -0.177664212f, 0.526879633f, 0.711606489f, -0.155787653f, 0.0525156018f, -0.0119440452f, -0.00337110647f, 0.00611337776f, -0.00377338565f},
+	{-0.000909602104f, 0.0005341853f, -0.000866327456f, -0.00150432225f, 0.0115314353f, -0.0353723047f, 0.0821474902f, -0.177543963f, 0.522690559f, 0.715000252f, -0.154715616f, 0.0516238584f, -0.0113389577f, -0.00372404493f, 0.00628378856f, -0.0038364306f},
+	{-0.000904557467f, 0.000520964334f, -0.000813913242f, -0.00163752426f, 0.0117744357f, -0.0357080753f, 0.0824568797f, -0.177402115f, 0.518492094f, 0.718370588f, -0.153617096f, 0.0507212693f, -0.0107295881f, -0.00407834433f, 0.00645445494f, -0.00389947286f},
+	{-0.000899337987f, 0.000507811193f, -0.000761880609f, -0.00176959115f, 0.0120145908f, -0.0360377051f, 0.0827544005f, -0.17723881f, 0.514284542f, 0.721717239f, -0.152492047f, 0.0498078953f, -0.0101159954f, -0.00443396408f, 0.00662535419f, -0.00396250237f},
+	{-0.000893942369f, 0.000494726528f, -0.000710234477f, -0.00190051137f, 0.0122518833f, -0.0363611795f, 0.0830400695f, -0.177054189f, 0.510068203f, 0.725039948f, -0.151340424f, 0.0488837984f, -0.0094982395f, -0.00479086319f, 0.00679646341f, -0.00402550903f},
+	{-0.000888369337f, 0.000481710953f, -0.00065897966f, -0.0020302736f, 0.0124862959f, -0.0366784848f, 0.0833139054f, -0.176848397f, 0.505843379f, 0.728338459f, -0.150162185f, 0.0479490424f, -0.00887638109f, -0.0051490003f, 0.00696775954f, -0.00408848264f},
+	{-0.000882617634f, 0.00046876505f, -0.000608120864f, -0.00215886678f, 0.0127178123f, -0.0369896082f, 0.083575928f, -0.176621578f, 0.501610374f, 0.73161252f, -0.148957291f, 0.0470036929f, -0.00825048169f, -0.00550833364f, 0.00713921938f, -0.00415141292f},
+	{-0.000876686025f, 0.00045588937f, -0.000557662687f, -0.00228628009f, 0.0129464162f, -0.0372945376f, 0.0838261585f, -0.176373881f, 0.497369489f, 0.734861877f, -0.147725704f, 0.0460478166f, -0.0076206036f, -0.00586882111f, 0.00731081952f, -0.00421428953f},
+	{-0.000870573293f, 0.000443084427f, -0.000507609619f, -0.00241250292f, 0.0131720922f, -0.037593262f, 0.0840646196f, -0.176105453f, 0.493121027f, 0.73808628f, -0.146467389f, 0.0450814823f, -0.00698680994f, -0.0062304202f, 0.00748253641f, -0.00427710203f},
+	{-0.000864278246f, 0.000430350709f, -0.000457966041f, -0.00253752496f, 0.013394825f, -0.037885771f, 0.0842913352f, -0.175816445f, 0.488865292f, 0.741285482f, -0.145182314f, 0.0441047602f, -0.00634916464f, -0.00659308806f, 0.00765434635f, -0.00433983994f},
+	{-0.00085779971f, 0.000417688665f, -0.00040873623f, -0.00266133608f, 0.0136146002f, -0.0381720553f, 0.0845063305f, -0.175507007f, 0.484602587f, 0.744459235f, -0.143870448f, 0.0431177219f, -0.00570773239f, -0.00695678147f, 0.00782622546f, -0.00440249268f},
+	{-0.000851136537f, 0.000405098719f, -0.000359924351f, -0.00278392643f, 0.0138314034f, -0.0384521062f, 0.0847096322f, -0.175177291f, 0.480333214f, 0.747607293f, -0.142531762f, 0.042120441f, -0.00506257871f, -0.00732145684f, 0.00799814973f, -0.00446504961f},
+	{-0.0008442876f, 0.000392581258f, -0.000311534464f, -0.0029052864f, 0.0140452211f, -0.0387259161f, 0.0849012682f, -0.174827452f, 0.476057478f, 0.750729414f, -0.141166233f, 0.0411129923f, -0.00441376989f, -0.00768707025f, 0.00817009499f, -0.00452750004f},
+	{-0.000837251796f, 0.000380136644f, -0.00026357052f, -0.00302540661f, 0.01425604f, -0.038993478f, 0.0850812678f, -0.174457645f, 0.471775681f, 0.753825356f, -0.139773835f, 0.0400954526f, -0.00376137297f, -0.00805357742f, 0.0083420369f, -0.00458983317f},
+	{-0.000830028048f, 0.000367765203f, -0.000216036366f, -0.00314427793f, 0.0144638474f, -0.039254786f, 0.0852496615f, -0.174068027f, 0.467488128f, 0.756894878f, -0.138354548f, 0.0390678999f, -0.00310545582f, -0.00842093371f, 0.008513951f, -0.00465203817f},
+	{-0.0008226153f, 0.000355467235f, -0.000168935737f, -0.00326189147f, 0.0146686311f, -0.0395098349f, 0.0854064812f, -0.173658755f, 0.463195122f, 0.759937744f, -0.136908355f, 0.038030414f, -0.00244608703f, -0.00878909417f, 0.00868581269f, -0.00471410413f},
+	{-0.000815012526f, 0.000343243009f, -0.000122272263f, -0.00337823858f, 0.0148703792f, -0.0397586203f, 0.08555176f, -0.173229987f, 0.458896966f, 0.762953717f, -0.135435238f, 0.0369830762f, -0.00178333597f, -0.00915801349f, 0.00885759721f, -0.00477602007f},
+	{-0.000807218722f, 0.000331092764f, -7.60494698e-05f, -0.00349331085f, 0.0150690806f, -0.0400011387f, 0.0856855323f, -0.172781886f, 0.454593965f, 0.765942562f, -0.133935184f, 0.0359259695f, -0.00111727278f, -0.00952764604f, 0.00902927968f, -0.00483777498f},
+	{-0.000799232912f, 0.000319016711f, -3.02707724e-05f, -0.00360710014f, 0.0152647244f, -0.0402373874f, 0.0858078338f, -0.172314611f, 0.450286421f, 0.768904047f, -0.132408182f, 0.0348591783f, -0.000447968325f, -0.00989794587f, 0.00920083507f, -0.00489935775f},
+	{-0.000791054149f, 0.000307015033f, 1.50605185e-05f, -0.0037195985f, 0.0154573002f, -0.0404673646f, 0.0859187015f, -0.171828326f, 0.445974638f, 0.771837943f, -0.130854223f, 0.0337827889f, 0.000224505757f, -0.0102688667f, 0.00937223823f, -0.00496075722f},
+	{-0.000782681511f, 0.000295087885f, 5.99411985e-05f, -0.00383079827f, 0.0156467982f, -0.0406910693f, 0.0860181735f, -0.171323195f, 0.441658919f, 0.77474402f, -0.129273301f, 0.0326968887f, 0.000900077106f, -0.0106403619f, 0.00954346389f, -0.0050219622f},
+	{-0.000774114104f, 0.000283235393f, 0.00010436817f, -0.00394069202f, 0.015833209f, -0.0409085013f, 0.0861062894f, -0.170799383f, 0.437339568f, 0.777622052f, -0.127665412f, 0.0316015671f, 0.00157867262f, -0.0110123846f, 0.00971448664f, -0.00508296141f},
+	{-0.000765351063f, 0.000271457657f, 0.000148338439f, -0.00404927253f, 0.0160165236f, -0.0411196611f, 0.0861830897f, -0.170257056f, 0.433016887f, 0.780471815f, -0.126030554f, 0.0304969149f, 0.00226021848f, -0.0113848877f, 0.00988528095f, -0.00514374353f},
+	{-0.000756391555f, 0.00025975475f, 0.000191849119f, -0.00415653287f, 0.0161967337f, -0.0413245504f, 0.0862486164f, -0.169696382f, 0.428691179f, 0.783293087f, -0.124368728f, 0.0293830244f, 0.00294464015f, -0.0117578235f, 0.0100558212f, -0.00520429719f},
+	{-0.000747234773f, 0.000248126719f, 0.000234897429f, -0.00426246632f, 0.0163738312f, -0.0415231712f, 0.0863029125f, -0.169117528f, 0.424362747f, 0.786085646f, -0.122679939f, 0.0282599895f, 0.00363186235f, -0.0121311442f, 0.0102260816f, -0.00526461095f},
+	{-0.000737879942f, 0.000236573586f, 0.00027748069f, -0.0043670664f, 0.0165478087f, -0.0417155267f, 0.0863460225f, -0.168520666f, 0.420031893f, 0.788849275f, -0.120964191f, 0.0271279058f, 0.00432180912f, -0.0125048019f, 0.0103960362f, -0.00532467336f},
+	{-0.000728326317f, 0.000225095346f, 0.00031959633f, -0.00447032689f, 0.0167186591f, -0.0419016208f, 0.0863779917f, -0.167905964f, 0.41569892f, 0.791583757f, -0.119221493f, 0.0259868702f, 0.0050144038f, -0.012878748f, 0.0105656592f, -0.00538447287f},
+	{-0.000718573186f, 0.00021369197f, 0.000361241879f, -0.00457224179f, 0.0168863758f, -0.0420814581f, 0.086398867f, -0.167273596f, 0.411364128f, 0.794288879f, -0.117451857f, 0.0248369813f, 0.00570956903f, -0.013252934f, 0.0107349244f, -0.00544399792f},
+	{-0.000708619867f, 0.000202363404f, 0.000402414972f, -0.00467280536f, 0.0170509528f, -0.0422550441f, 0.0864086961f, -0.166623734f, 0.407027819f, 0.796964429f, -0.115655296f, 0.0236783392f, 0.00640722676f, -0.0136273108f, 0.0109038057f, -0.0055032369f},
+	{-0.00069846571f, 0.000191109572f, 0.000443113347f, -0.00477201207f, 0.0172123843f, -0.0424223852f, 0.0864075281f, -0.165956552f, 0.402690295f, 0.799610196f, -0.113831825f, 0.0225110457f, 0.00710729827f, -0.0140018294f, 0.0110722766f, -0.00556217815f},
+	{-0.000688110101f, 0.000179930371f, 0.000483334845f, -0.00486985665f, 0.0173706653f, -0.0425834883f, 0.0863954131f, -0.165272225f, 0.398351857f, 0.802225974f, -0.111981463f, 0.0213352039f, 0.00780970416f, -0.0143764402f, 0.011240311f, -0.00562080996f},
+	{-0.000677552456f, 0.000168825678f, 0.000523077409f, -0.00496633408f, 0.017525791f, -0.0427383613f, 0.0863724025f, -0.164570927f, 0.394012803f, 0.804811556f, -0.110104232f, 0.0201509184f, 0.00851436437f, -0.0147510935f, 0.0114078822f, -0.00567912059f},
+	{-0.000666792226f, 0.000157795347f, 0.000562339083f, -0.00506143953f, 0.0176777571f, -0.0428870129f, 0.0863385488f, -0.163852837f, 0.389673435f, 0.80736674f, -0.108200154f, 0.0189582955f, 0.00922119819f, -0.0151257393f, 0.0115749638f, -0.00573709827f},
+	{-0.000655828897f, 0.000146839208f, 0.000601118016f, -0.00515516846f, 0.0178265599f, -0.0430294524f, 0.0862939054f, -0.163118131f, 0.385334051f, 0.809891325f, -0.106269256f, 0.0177574431f, 0.00993012425f, -0.0155003274f, 0.0117415291f, -0.00579473119f},
+	{-0.000644661989f, 0.000135957072f, 0.000639412453f, -0.00524751654f, 0.0179721961f, -0.0431656901f, 0.0862385271f, -0.162366989f, 0.380994951f, 0.812385112f, -0.104311565f, 0.0165484702f, 0.0106410605f, -0.0158748074f, 0.0119075513f, -0.00585200749f},
+	{-0.000633291057f, 0.000125148728f, 0.000677220744f, -0.00533847967f, 0.0181146626f, -0.043295737f, 0.0861724696f, -0.161599589f, 0.376656432f, 0.814847905f, -0.102327114f, 0.0153314877f, 0.0113539244f, -0.0162491286f, 0.0120730037f, -0.00590891529f},
+	{-0.000621715693f, 0.000114413943f, 0.000714541336f, -0.005428054f, 0.0182539572f, -0.0434196047f, 0.0860957898f, -0.160816112f, 0.372318794f, 0.81727951f, -0.100315936f, 0.0141066078f, 0.0120686326f, -0.0166232399f, 0.0122378594f, -0.00596544268f},
+	{-0.000609935524f, 0.000103752466f, 0.000751372779f, -0.0055162359f, 0.0183900779f, -0.0435373058f, 0.0860085458f, -0.16001674f, 0.367982332f, 0.819679735f, -0.0982780669f, 0.0128739443f, 0.0127851013f, -0.0169970904f, 0.0124020914f, -0.00602157771f},
+	{-0.000597950215f, 9.31640248e-05f, 0.000787713717f, -0.00560302198f, 0.0185230231f, -0.0436488534f, 0.0859107963f, -0.159201654f, 0.363647343f, 0.82204839f, -0.0962135454f, 0.0116336123f, 0.0135032459f, -0.0173706286f, 0.0125656727f, -0.00607730842f},
+	{-0.000585759468f, 8.26483297e-05f, 0.000823562896f, -0.00568840909f, 0.0186527918f, -0.0437542616f, 0.0858026016f, -0.158371036f, 0.359314125f, 0.824385289f, -0.0941224127f, 0.0103857286f, 0.0142229814f, -0.017743803f, 0.0127285762f, -0.00613262281f},
+	{-0.000573363021f, 7.22050712e-05f, 0.00085891916f, -0.00577239429f, 0.0187793833f, -0.0438535452f, 0.0856840227f, -0.157525072f, 0.354982971f, 0.826690248f, -0.0920047127f, 0.00913041137f, 0.0149442221f, -0.0181165618f, 0.0128907749f, -0.00618750887f},
+	{-0.000560760652f, 6.1833922e-05f, 0.000893781449f, -0.0058549749f, 0.0189027974f, -0.0439467196f, 0.0855551218f, -0.156663944f, 0.350654177f, 0.828963084f, -0.0898604918f, 0.00786778014f, 0.0156668817f, -0.018488853f, 0.0130522415f, -0.00624195455f},
+	{-0.000547952176f, 5.15345376e-05f, 0.000928148799f, -0.00593614844f, 0.0190230345f, -0.044033801f, 0.085415962f, -0.155787838f, 0.346328036f, 0.831203617f, -0.0876897987f, 0.00659795601f, 0.0163908733f, -0.0188606245f, 0.0132129487f, -0.0062959478f},
+	{-0.000534937448f, 4.1306556e-05f, 0.000962020343f, -0.00601591268f, 0.0191400952f, -0.0441148064f, 0.0852666075f, -0.15489694f, 0.342004842f, 0.833411669f, -0.0854926851f, 0.0053210615f, 0.0171161097f, -0.0192318239f, 0.0133728693f, -0.00634947653f},
+	{-0.000521716362f, 3.11495991e-05f, 0.000995395311f, -0.0060942656f, 0.0192539807f, -0.0441897534f, 0.0851071234f, -0.153991436f, 0.337684888f, 0.835587067f, -0.0832692048f, 0.00403722056f, 0.0178425028f, -0.0196023987f, 0.013531976f, -0.00640252865f},
+	{-0.000508288853f, 2.10632725e-05f, 0.00102827303f, -0.00617120543f, 0.0193646925f, -0.0442586605f, 0.0849375758f, -0.153071514f, 0.333368465f, 0.837729638f, -0.0810194145f, 0.00274655856f, 0.0185699642f, -0.0199722963f, 0.0136902413f, -0.00645509206f},
+	{-0.000494654893f, 1.10471664e-05f, 0.0010606529f, -0.0062467306f, 0.0194722327f, -0.0443215468f, 0.084758032f, -0.152137362f, 0.329055864f, 0.839839212f, -0.0787433733f, 0.00144920229f, 0.0192984047f, -0.0203414637f, 0.0138476379f, -0.00650715463f},
+	{-0.000480814498f, 1.10085614e-06f, 0.00109253446f, -0.00632083979f, 0.0195766036f, -0.0443784321f, 0.0845685599f, -0.151189167f, 0.324747374f, 0.841915622f, -0.0764411428f, 0.000145279956f, 0.0200277348f, -0.0207098479f, 0.0140041384f, -0.00655870425f},
+	{-0.000466767722f, -8.7760975e-06f, 0.00112391729f, -0.00639353187f, 0.0196778083f, -0.0444293369f, 0.0843692286f, -0.150227119f, 0.320443287f, 0.843958702f, -0.0741127874f, -0.00116507884f, 0.0207578644f, -0.0210773959f, 0.0141597151f, -0.00660972876f},
+	{-0.000452514665f, -1.85841476e-05f, 0.00115480109f, -0.00646480597f, 0.01977585f, -0.0444742824f, 0.0841601081f, -0.149251408f, 0.316143888f, 0.845968291f, -0.0717583739f, -0.00248174311f, 0.021488703f, -0.0214440542f, 0.0143143408f, -0.00666021603f},
+	{-0.000438055463f, -2.83237606e-05f, 0.00118518566f, -0.00653466141f, 0.0198707323f, -0.0445132906f, 0.0839412692f, -0.148262224f, 0.311849467f, 0.847944229f, -0.0693779715f, -0.00380458047f, 0.0222201594f, -0.0218097694f, 0.0144679877f, -0.00671015391f},
+	{-0.000423390298f, -3.79954158e-05f, 0.00121507087f, -0.00660309776f, 0.0199624595f, -0.0445463841f, 0.0837127837f, -0.147259758f, 0.307560309f, 0.849886359f, -0.0669716523f, -0.00513345719f, 0.022952142f, -0.0221744881f, 0.0146206285f, -0.00675953024f},
+	{-0.000408519393f, -4.7599605e-05f, 0.00124445668f, -0.00667011477f, 0.0200510361f, -0.0445735862f, 0.0834747243f, -0.146244201f, 0.303276701f, 0.851794527f, -0.0645394908f, -0.00646823814f, 0.0236845588f, -0.0225381563f, 0.0147722356f, -0.0068083329f},
+	{-0.000393443015f, -5.71368314e-05f, 0.00127334316f, -0.00673571245f, 0.0201364672f, -0.0445949208f, 0.0832271645f, -0.145215745f, 0.298998925f, 0.85366858f, -0.0620815641f, -0.00780878687f, 0.0244173173f, -0.0229007205f, 0.0149227814f, -0.00685654971f},
+	{-0.000378161473f, -6.66076099e-05f, 0.00130173045f, -0.00679989099f, 0.020218758f, -0.0446104126f, 0.082970179f, -0.144174582f, 0.294727267f, 0.85550837f, -0.0595979517f, -0.00915496557f, 0.0251503244f, -0.0232621265f, 0.0150722383f, -0.00690416855f},
+	{-0.00036267512f, -7.60124659e-05f, 0.00132961878f, -0.00686265083f, 0.0202979145f, -0.0446200868f, 0.0827038429f, -0.143120906f, 0.290462008f, 0.85731375f, -0.0570887358f, -0.0105066351f, 0.0258834867f, -0.0236223204f, 0.0152205789f, -0.00695117728f},
+	{-0.000346984353f, -8.5351935e-05f, 0.00135700847f, -0.00692399258f, 0.0203739428f, -0.0446239695f, 0.0824282324f, -0.142054909f, 0.28620343f, 0.859084576f, -0.0545540013f, -0.011863655f, 0.0266167103f, -0.0239812481f, 0.0153677756f, -0.00699756377f},
+	{-0.000331089614f, -9.46265626e-05f, 0.00138389993f, -0.0069839171f, 0.0204468496f, -0.0446220872f, 0.0821434245f, -0.140976785f, 0.281951813f, 0.860820707f, -0.0519938353f, -0.0132258836f, 0.0273499009f, -0.0243388553f, 0.0155138008f, -0.00704331591f},
+	{-0.000314991387f, -0.000103836903f, 0.00141029366f, -0.00704242545f, 0.0205166419f, -0.0446144671f, 0.081849497f, -0.139886729f, 0.277707437f, 0.862522005f, -0.0494083278f, -0.0145931777f, 0.0280829638f, -0.0246950878f, 0.015658627f, -0.00708842159f},
+	{-0.000298690204f, -0.00011298352f, 0.00143619022f, -0.00709951889f, 0.020583327f, -0.0446011373f, 0.0815465286f, -0.138784935f, 0.273470579f, 0.864188333f, -0.046797571f, -0.015965393f, 0.0288158038f, -0.0250498912f, 0.0158022267f, -0.00713286872f},
+	{-0.000282186639f, -0.000122066983f, 0.00146159028f, -0.0071551989f, 0.020646913f, -0.0445821262f, 0.0812345988f, -0.137671597f, 0.269241516f, 0.86581956f, -0.0441616601f, -0.0173423838f, 0.0295483255f, -0.025403211f, 0.0159445724f, -0.00717664523f},
+	{-0.000265481315f, -0.000131087873f, 0.00148649458f, -0.00720946716f, 0.0207074079f, -0.0445574629f, 0.0809137876f, -0.13654691f, 0.265020524f, 0.867415554f, -0.0415006924f, -0.0187240034f, 0.0302804328f, -0.0257549927f, 0.0160856367f, -0.00721973907f},
+	{-0.000248574898f, -0.000140046774f, 0.00151090394f, -0.00726232556f, 0.0207648204f, -0.0445271772f, 0.0805841761f, -0.135411072f, 0.260807877f, 0.868976188f, -0.0388147681f, -0.0201101034f, 0.0310120296f, -0.0261051819f, 0.0162253921f, -0.00726213822f},
+	{-0.0002314681f, -0.000148944279f, 0.00153481927f, -0.00731377618f, 0.0208191595f, -0.0444912996f, 0.0802458461f, -0.134264276f, 0.256603849f, 0.870501338f, -0.0361039896f, -0.0215005346f, 0.031743019f, -0.0264537239f, 0.0163638113f, -0.00730383065f},
+	{-0.00021416168f, -0.000157780986f, 0.00155824156f, -0.00736382132f, 0.0208704345f, -0.0444498609f, 0.07989888f, -0.133106719f, 0.252408712f, 0.871990882f, -0.033368462f, -0.0228951464f, 0.0324733043f, -0.0268005641f, 0.0165008668f, -0.0073448044f},
+	{-0.000196656445f, -0.000166557498f, 0.00158117187f, -0.00741246347f, 0.0209186553f, -0.0444028929f, 0.079543361f, -0.131938597f, 0.248222736f, 0.8734447f, -0.0306082931f, -0.0242937868f, 0.0332027879f, -0.0271456478f, 0.0166365314f, -0.00738504751f},
+	{-0.000178953245f, -0.000175274425f, 0.00160361135f, -0.00745970533f, 0.020963832f, -0.0443504276f, 0.0791793731f, -0.130760108f, 0.24404619f, 0.874862676f, -0.0278235928f, -0.0256963029f, 0.0339313722f, -0.0274889204f, 0.0167707778f, -0.00742454805f},
+	{-0.000161052981f, -0.000183932378f, 0.00162556121f, -0.00750554977f, 0.021005975f, -0.0442924979f, 0.078807001f, -0.129571447f, 0.239879344f, 0.876244697f, -0.025014474f, -0.0271025404f, 0.0346589592f, -0.0278303271f, 0.0169035788f, -0.00746329415f},
+	{-0.000142956598f, -0.000192531975f, 0.00164702276f, -0.00754999989f, 0.0210450954f, -0.0442291371f, 0.0784263299f, -0.128372812f, 0.235722462f, 0.877590653f, -0.0221810518f, -0.0285123439f, 0.0353854507f, -0.0281698133f, 0.0170349072f, -0.00750127393f},
+	{-0.000124665091f, -0.000201073836f, 0.00166799736f, -0.00759305897f, 0.0210812043f, -0.0441603791f, 0.078037446f, -0.1271644f, 0.231575811f, 0.878900434f, -0.0193234439f, -0.0299255568f, 0.0361107479f, -0.0285073242f, 0.017164736f, -0.00753847559f},
+	{-0.0001061795f, -0.000209558583f, 0.00168848648f, -0.00763473047f, 0.0211143133f, -0.0440862584f, 0.0776404357f, -0.125946407f, 0.227439655f, 0.880173938f, -0.0164417705f, -0.0313420215f, 0.0368347521f, -0.0288428052f, 0.0172930381f, -0.00757488734f},
+	{-8.75009152e-05f, -0.000217986843f, 0.00170849163f, -0.00767501806f, 0.0211444346f, -0.0440068101f, 0.0772353866f, -0.124719032f, 0.223314255f, 0.881411061f, -0.0135361542f, -0.0327615791f, 0.0375573641f, -0.0291762016f, 0.0174197865f, -0.00761049745f},
+	{-6.86304729e-05f, -0.000226359241f, 0.0017280144f, -0.00771392559f, 0.0211715804f, -0.0439220697f, 0.0768223866f, -0.123482471f, 0.219199874f, 0.882611705f, -0.0106067203f, -0.0341840695f, 0.0382784845f, -0.0295074587f, 0.0175449543f, -0.00764529422f},
+	{-4.95693587e-05f, -0.000234676406f, 0.00174705648f, -0.00775145708f, 0.0211957634f, -0.0438320735f, 0.0764015242f, -0.122236923f, 0.21509677f, 0.883775774f, -0.00765359639f, -0.0356093318f, 0.0389980135f, -0.0298365219f, 0.0176685148f, -0.00767926601f},
+	{-3.03188061e-05f, -0.000242938966f, 0.00176561958f, -0.00778761678f, 0.0212169966f, -0.0437368581f, 0.0759728886f, -0.120982585f, 0.211005201f, 0.884903173f, -0.00467691263f, -0.0370372036f, 0.0397158514f, -0.0301633367f, 0.0177904412f, -0.00771240121f},
+	{-1.08800971e-05f, -0.000251147552f, 0.00178370553f, -0.00782240908f, 0.0212352936f, -0.0436364606f, 0.0755365698f, -0.119719654f, 0.206925424f, 0.885993813f, -0.00167680161f, -0.0384675218f, 0.040431898f, -0.0304878485f, 0.0179107069f, -0.00774468828f},
+	{8.74543758e-06f, -0.000259302792f, 0.00180131621f, -0.00785583857f, 0.0212506679f, -0.0435309189f, 0.0750926579f, -0.118448328f, 0.202857695f, 0.887047607f, 0.00134660159f, -0.0399001219f, 0.0411460529f, -0.0308100028f, 0.0180292853f, -0.00777611572f},
+	{2.85564185e-05f, -0.000267405314f, 0.00181845355f, -0.00788791002f, 0.0212631338f, -0.0434202712f, 0.0746412441f, -0.117168805f, 0.198802265f, 0.88806447f, 0.00439315945f, -0.0413348386f, 0.0418582157f, -0.0311297452f, 0.01814615f, -0.00780667209f},
+	{4.85514175e-05f, -0.000275455745f, 0.00183511958f, -0.00791862838f, 0.0212727056f, -0.0433045563f, 0.0741824198f, -0.115881283f, 0.194759388f, 0.88904432f, 0.00746273202f, -0.0427715055f, 0.0425682856f, -0.0314470213f, 0.0182612746f, -0.00783634601f},
+	{6.87289572e-05f, -0.000283454711f, 0.00185131638f, -0.00794799876f, 0.021279398f, -0.0431838133f, 0.0737162771f, -0.114585959f, 0.190729313f, 0.889987079f, 0.0105551769f, -0.0442099551f, 0.0432761617f, -0.031761777f, 0.0183746329f, -0.00786512615f},
+	{8.90875114e-05f, -0.000291402833f, 0.00186704608f, -0.00797602647f, 0.0212832263f, -0.0430580822f, 0.0732429086f, -0.11328303f, 0.18671229f, 0.890892671f, 0.0136703493f, -0.045650019f, 0.043981743f, -0.032073958f, 0.0184861987f, -0.00789300125f},
+	{0.000109625505f, -0.000299300733f, 0.00188231091f, -0.00800271697f, 0.0212842057f, -0.042927403f, 0.0727624073f, -0.111972695f, 0.182708564f, 0.891761024f, 0.0168081019f, -0.0470915276f, 0.0446849283f, -0.0323835102f, 0.0185959461f, -0.00791996012f},
+	{0.000130341312f, -0.000307149026f, 0.00189711313f, -0.0080280759f, 0.021282352f, -0.0427918166f, 0.0722748668f, -0.110655149f, 0.178718381f, 0.892592069f, 0.019968285f, -0.0485343107f, 0.0453856162f, -0.0326903796f, 0.018703849f, -0.00794599161f},
+	{0.000151233259f, -0.000314948326f, 0.00191145508f, -0.00805210908f, 0.0212776813f, -0.0426513641f, 0.0717803813f, -0.109330591f, 0.174741984f, 0.893385737f, 0.0231507468f, -0.0499781967f, 0.0460837054f, -0.0329945125f, 0.0188098818f, -0.00797108468f},
+	{0.000172299623f, -0.000322699243f, 0.00192533916f, -0.00807482247f, 0.02127021f, -0.0425060872f, 0.0712790453f, -0.107999218f, 0.170779616f, 0.894141967f, 0.0263553326f, -0.0514230133f, 0.0467790941f, -0.0332958549f, 0.0189140188f, -0.00799522833f},
+	{0.000193538631f, -0.000330402379f, 0.00193876782f, -0.00809622221f, 0.0212599546f, -0.042356028f, 0.0707709538f, -0.106661226f, 0.166831517f, 0.894860698f, 0.0295818857f, -0.0528685873f, 0.0474716808f, -0.0335943534f, 0.0190162345f, -0.00801841164f},
+	{0.000214948461f, -0.000338058335f, 0.00195174358f, -0.00811631462f, 0.0212469322f, -0.042201229f, 0.0702562023f, -0.105316812f, 0.162897925f, 0.895541871f, 0.0328302469f, -0.0543147444f, 0.0481613637f, -0.0338899544f, 0.0191165034f, -0.00804062377f},
+	{0.00023652724f, -0.000345667704f, 0.00196426902f, -0.00813510615f, 0.0212311601f, -0.0420417333f, 0.0697348867f, -0.103966172f, 0.158979076f, 0.896185433f, 0.0361002547f, -0.0557613097f, 0.0488480409f, -0.0341826046f, 0.0192148004f, -0.00806185396f},
+	{0.000258273047f, -0.000353231072f, 0.00197634676f, -0.00815260341f, 0.0212126559f, -0.0418775842f, 0.0692071033f, -0.102609504f, 0.155075205f, 0.896791332f, 0.0393917452f, -0.0572081071f, 0.0495316107f, -0.0344722508f, 0.0193111003f, -0.00808209153f},
+	{0.000280183912f, -0.000360749021f, 0.00198797949f, -0.0081688132f, 0.0211914374f, -0.0417088258f, 0.0686729488f, -0.101247001f, 0.151186545f, 0.897359519f, 0.0427045521f, -0.0586549599f, 0.0502119709f, -0.0347588398f, 0.0194053783f, -0.00810132587f},
+	{0.000302257815f, -0.000368222124f, 0.00199916997f, -0.00818374244f, 0.0211675227f, -0.0415355021f, 0.0681325203f, -0.0998788615f, 0.147313328f, 0.897889949f, 0.0460385069f, -0.0601016903f, 0.0508890198f, -0.035042319f, 0.0194976094f, -0.00811954648f},
+	{0.000324492685f, -0.000375650949f, 0.00200992097f, -0.00819739822f, 0.0211409305f, -0.0413576579f, 0.0675859154f, -0.0985052794f, 0.143455782f, 0.89838258f, 0.0493934388f, -0.0615481199f, 0.0515626553f, -0.0353226356f, 0.0195877691f, -0.00813674291f},
+	{0.000346886404f, -0.000383036052f, 0.00202023536f, -0.00820978777f, 0.0211116793f, -0.0411753383f, 0.0670332318f, -0.0971264501f, 0.139614135f, 0.898837372f, 0.0527691747f, -0.0629940693f, 0.0522327754f, -0.035599737f, 0.0196758329f, -0.00815290485f},
+	{0.000369436802f, -0.000390377984f, 0.00203011603f, -0.00822091848f, 0.0210797882f, -0.0409885888f, 0.0664745677f, -0.0957425684f, 0.135788613f, 0.89925429f, 0.056165539f, -0.0644393585f, 0.0528992781f, -0.0358735709f, 0.0197617765f, -0.00816802203f},
+	{0.000392141663f, -0.000397677287f, 0.00203956594f, -0.00823079787f, 0.0210452765f, -0.0407974553f, 0.0659100217f, -0.0943538286f, 0.131979438f, 0.8996333f, 0.0595823541f, -0.0658838065f, 0.0535620615f, -0.0361440854f, 0.0198455758f, -0.00818208431f},
+	{0.000414998719f, -0.000404934491f, 0.00204858809f, -0.00823943362f, 0.0210081637f, -0.0406019839f, 0.0653396926f, -0.0929604247f, 0.128186833f, 0.899974372f, 0.06301944f, -0.0673272317f, 0.0542210236f, -0.0364112283f, 0.0199272069f, -0.00819508164f},
+	{0.000438005653f, -0.000412150121f, 0.00205718554f, -0.00824683355f, 0.0209684697f, -0.0404022214f, 0.0647636796f, -0.0915625504f, 0.124411017f, 0.900277479f, 0.0664766145f, -0.0687694518f, 0.0548760627f, -0.0366749481f, 0.0200066458f, -0.00820700405f},
+	{0.0004611601f, -0.000419324687f, 0.00206536137f, -0.00825300561f, 0.0209262146f, -0.0401982146f, 0.0641820821f, -0.0901603989f, 0.120652208f, 0.900542597f, 0.0699536932f, -0.0702102835f, 0.0555270767f, -0.0369351932f, 0.0200838692f, -0.0082178417f},
+	{0.000484459646f, -0.000426458693f, 0.00207311873f, -0.00825795789f, 0.0208814186f, -0.0399900109f, 0.0635949998f, -0.0887541629f, 0.116910622f, 0.900769705f, 0.0734504894f, -0.0716495431f, 0.0561739641f, -0.0371919125f, 0.0201588536f, -0.00822758483f},
+	{0.000507901828f, -0.000433552628f, 0.00208046082f, -0.00826169862f, 0.0208341024f, -0.039777658f, 0.0630025328f, -0.0873440347f, 0.113186472f, 0.900958786f, 0.0769668142f, -0.0730870461f, 0.0568166231f, -0.0374450549f, 0.0202315758f, -0.0082362238f},
+	{0.000531484133f, -0.000440606972f, 0.00208739087f, -0.00826423617f, 0.0207842868f, -0.0395612039f, 0.0624047813f, -0.0859302062f, 0.10947997f, 0.901109825f, 0.0805024766f, -0.0745226073f, 0.0574549521f, -0.0376945698f, 0.0203020127f, -0.00824374906f},
+	{0.000555204002f, -0.000447622193f, 0.00209391216f, -0.00826557902f, 0.020731993f, -0.039340697f, 0.0618018457f, -0.0845128686f, 0.105791326f, 0.901222809f, 0.0840572835f, -0.0759560408f, 0.0580888499f, -0.0379404065f, 0.0203701417f, -0.0082501512f},
+	{0.000579058823f, -0.000454598748f, 0.00210002801f, -0.00826573581f, 0.0206772421f, -0.0391161858f, 0.0611938267f, -0.083092213f, 0.102120747f, 0.901297732f, 0.0876310393f, -0.0773871602f, 0.0587182149f, -0.0381825149f, 0.0204359401f, -0.00825542089f},
+	{0.000603045941f, -0.000461537079f, 0.00210574179f, -0.00826471527f, 0.0206200559f, -0.0388877195f, 0.0605808253f, -0.0816684294f, 0.0984684393f, 0.901334587f, 0.0912235466f, -0.0788157784f, 0.0593429462f, -0.0384208451f, 0.0204993856f, -0.00825954895f},
+};
+
+/* ========== Saturator ========== */
+/* tanh(x) for x in [-5, +5] */
+const float tanh_table[257] = {
+	-0.999909204f, -0.999901827f, -0.99989385f, -0.999885225f, -0.999875899f, -0.999865816f, -0.999854913f, -0.999843124f,
+	-0.999830378f, -0.999816596f, -0.999801695f, -0.999785582f, -0.999768161f, -0.999749325f, -0.999728958f, -0.999706937f,
+	-0.999683128f, -0.999657384f, -0.999629549f, -0.999599452f, -0.999566912f, -0.999531728f, -0.999493687f, -0.999452557f,
+	-0.999408086f, -0.999360004f, -0.999308017f, -0.999251809f, -0.999191037f, -0.999125331f, -0.999054291f, -0.998977484f,
+	-0.998894443f, -0.998804661f, -0.998707593f, -0.998602649f, -0.998489189f, -0.998366524f, -0.998233908f, -0.998090537f,
+	-0.997935538f, -0.997767971f, -0.997586821f, -0.997390987f, -0.997179283f, -0.996950427f, -0.996703034f, -0.996435607f,
+	-0.996146531f, -0.995834058f, -0.995496305f, -0.995131236f, -0.994736652f, -0.994310181f, -0.99384926f, -0.993351126f,
+	-0.992812795f, -0.992231047f, -0.991602409f, -0.990923137f, -0.990189189f, -0.98939621f, -0.988539507f, -0.98761402f,
+	-0.986614298f, -0.985534472f, -0.984368222f, -0.983108746f, -0.981748725f, -0.980280289f, -0.978694978f, -0.976983702f,
+	-0.975136698f, -0.973143491f, -0.970992841f, -0.968672703f, -0.966170173f, -0.963471443f, -0.960561744f, -0.957425296f,
+	-0.95404526f, -0.95040368f, -0.946481434f, -0.942258186f, -0.937712339f, -0.932820989f, -0.927559888f, -0.921903415f,
+	-0.915824544f, -0.909294839f, -0.902284443f, -0.894762093f, -0.886695149f, -0.878049638f, -0.868790325f, -0.858880808f,
+	-0.84828364f, -0.836960488f, -0.824872321f, -0.811979641f, -0.798242755f, -0.783622091f, -0.768078563f, -0.751573983f,
+	-0.73407152f, -0.71553621f, -0.695935517f, -0.675239927f, -0.653423588f, -0.630464979f, -0.606347593f, -0.581060637f,
+	-0.554599722f, -0.526967527f, -0.498174426f, -0.468239054f, -0.437188785f, -0.405060115f, -0.37189891f, -0.337760521f,
+	-0.302709729f, -0.266820527f, -0.230175711f, -0.192866293f, -0.15499073f, -0.116653989f, -0.0779664414f, -0.0390426439f,
+	0.0f, 0.0390426439f, 0.0779664414f, 0.116653989f, 0.15499073f, 0.192866293f, 0.230175711f, 0.266820527f,
+	0.302709729f, 0.337760521f, 0.37189891f, 0.405060115f, 0.437188785f, 0.468239054f, 0.498174426f, 0.526967527f,
+	0.554599722f, 0.581060637f, 0.606347593f, 0.630464979f, 0.653423588f, 0.675239927f, 0.695935517f, 0.71553621f,
+	0.73407152f, 0.751573983f, 0.768078563f, 0.783622091f, 0.798242755f, 0.811979641f, 0.824872321f, 0.836960488f,
+	0.84828364f, 0.858880808f, 0.868790325f, 0.878049638f, 0.886695149f, 0.894762093f, 0.902284443f, 0.909294839f,
+	0.915824544f, 0.921903415f, 0.927559888f, 0.932820989f, 0.937712339f, 0.942258186f, 0.946481434f, 0.95040368f,
+	0.95404526f, 0.957425296f, 0.960561744f, 0.963471443f, 0.966170173f, 0.968672703f, 0.970992841f, 0.973143491f,
+	0.975136698f, 0.976983702f, 0.978694978f, 0.980280289f, 0.981748725f, 0.983108746f, 0.984368222f, 0.985534472f,
+	0.986614298f, 0.98761402f, 0.988539507f, 0.98939621f, 0.990189189f, 0.990923137f, 0.991602409f, 0.992231047f,
+	0.992812795f, 0.993351126f, 0.99384926f, 0.994310181f, 0.994736652f, 0.995131236f, 0.995496305f, 0.995834058f,
+	0.996146531f, 0.996435607f, 0.996703034f, 0.996950427f, 0.997179283f, 0.997390987f, 0.997586821f, 0.997767971f,
+	0.997935538f, 0.998090537f, 0.998233908f, 0.998366524f, 0.998489189f, 0.998602649f, 0.998707593f, 0.998804661f,
+	0.998894443f, 0.998977484f, 0.999054291f, 0.999125331f, 0.999191037f, 0.999251809f, 0.999308017f, 0.999360004f,
+	0.999408086f, 0.999452557f, 0.999493687f, 0.999531728f, 0.999566912f, 0.999599452f, 0.999629549f, 0.999657384f,
+	0.999683128f, 0.999706937f, 0.999728958f, 0.999749325f, 0.999768161f, 0.999785582f, 0.999801695f, 0.999816596f,
+	0.999830378f, 0.999843124f, 0.999854913f, 0.999865816f, 0.999875899f, 0.999885225f, 0.99989385f, 0.999901827f,
+	0.999909204f,
+};
+
+/* ========== Filter ========== */
+/* {g, Glp, Gtot} for log2(fc/sr) from -13, 24 rows per octave */
+const float filter_table[283][3] = {
+	{0.000383495216f, 0.000383348204f, 2.16291674e-14f},
+	{0.000394732484f, 0.000394576732f, 2.42779198e-14f},
+	{0.00040629903f, 0.000406134019f, 2.72510439e-14f},
+	{0.000418204502f, 0.00041802968f, 3.0588263e-14f},
+	{0.000430458831f, 0.000430273616f, 3.43341648e-14f},
+	{0.000443072239f, 0.000442876013f, 3.85387975e-14f},
+	{0.000456055248f, 0.000455847357f, 4.32583383e-14f},
+	{0.000469418689f, 0.000469198439f, 4.85558438e-14f},
+	{0.000483173709f, 0.000482940365f, 5.45020928e-14f},
+	{0.000497331781f, 0.000497084566f, 6.11765319e-14f},
+	{0.000511904718f, 0.000511642805f, 6.86683366e-14f},
+	{0.000526904673f, 0.000526627191f, 7.70776034e-14f},
+	{0.000542344162f, 0.000542050184f, 8.65166865e-14f},
+	{0.000558236062f, 0.000557924608f, 9.71116994e-14f},
+	{0.000574593631f, 0.000574263663f, 1.090042e-13f},
+	{0.000591430513f, 0.00059108093f, 1.2235308e-13f},
+	{0.000608760754f, 0.00060839039f, 1.37336693e-13f},
+	{0.000626598811f, 0.00062620643f, 1.5415523e-13f},
+	{0.000644959562f, 0.000644543858f, 1.73033401e-13f},
+	{0.000663858325f, 0.00066341791f, 1.94223432e-13f},
+	{0.000683310865f, 0.00068284427f, 2.18008439e-13f},
+	{0.000703333408f, 0.000702839078f, 2.44706208e-13f},
+	{0.000723942657f, 0.000723418944f, 2.74673442e-13f},
+	{0.000745155804f, 0.00074460096f, 3.08310528e-13f},
+	{0.000766990544f, 0.000766402721f, 3.46066882e-13f},
+	{0.000789465092f, 0.000788842329f, 3.88446959e-13f},
+	{0.000812598195f, 0.000811938415f, 4.36016991e-13f},
+	{0.000836409151f, 0.000835710155f, 4.8941255e-13f},
+	{0.000860917821f, 0.000860177279f, 5.49347044e-13f},
+	{0.000886144652f, 0.000885360095f, 6.16621244e-13f},
+	{0.000912110687f, 0.000911279499f, 6.92133988e-13f},
+	{0.000938837585f, 0.000937956996f, 7.76894185e-13f},
+	{0.000966347643f, 0.000965414717f, 8.72034299e-13f},
+	{0.000994663809f, 0.000993675436f, 9.78825478e-13f},
+	{0.0010238097f, 0.00102276259f, 1.09869454e-12f},
+	{0.00105380964f, 0.00105270029f, 1.23324302e-12f},
+	{0.00108468864f, 0.00108351337f, 1.38426861e-12f},
+	{0.00111647247f, 0.00111522735f, 1.55378913e-12f},
+	{0.00114918764f, 0.00114786852f, 1.7440695e-12f},
+	{0.00118286144f, 0.00118146393f, 1.95765203e-12f},
+	{0.00121752196f, 0.0012160414f, 2.19739035e-12f},
+	{0.00125319811f, 0.00125162957f, 2.46648756e-12f},
+	{0.00128991966f, 0.00128825791f, 2.76853902e-12f},
+	{0.00132771724f, 0.00132595674f, 3.10758039e-12f},
+	{0.00136662237f, 0.00136475726f, 3.48814154e-12f},
+	{0.00140666751f, 0.00140469158f, 3.91530708e-12f},
+	{0.00144788607f, 0.00144579273f, 4.39478429e-12f},
+	{0.00149031244f, 0.00148809471f, 4.9329794e-12f},
+	{0.00153398199f, 0.00153163249f, 5.53708313e-12f},
+	{0.00157893117f, 0.00157644207f, 6.21516684e-12f},
+	{0.00162519746f, 0.00162256048f, 6.97629028e-12f},
+	{0.00167281947f, 0.00167002582f, 7.83062271e-12f},
+	{0.00172183692f, 0.00171887729f, 8.78957876e-12f},
+	{0.0017722907f, 0.00176915524f, 9.8659709e-12f},
+	{0.00182422289f, 0.00182090116f, 1.10741807e-11f},
+	{0.00187767683f, 0.00187415776f, 1.24303508e-11f},
+	{0.00193269709f, 0.00192896898f, 1.39526009e-11f},
+	{0.00198932959f, 0.00198538001f, 1.56612696e-11f},
+	{0.00204762155f, 0.00204343737f, 1.75791863e-11f},
+	{0.00210762162f, 0.00210318889f, 1.9731976e-11f},
+	{0.00216937984f, 0.00216468382f, 2.2148402e-11f},
+	{0.00223294773f, 0.00222797278f, 2.486075e-11f},
+	{0.00229837832f, 0.00229310789f, 2.79052594e-11f},
+	{0.00236572619f, 0.00236014274f, 3.13226077e-11f},
+	{0.00243504753f, 0.00242913248f, 3.5158454e-11f},
+	{0.00250640016f, 0.00250013383f, 3.94640489e-11f},
+	{0.00257984361f, 0.00257320515f, 4.42969192e-11f},
+	{0.00265543915f, 0.00264840647f, 4.97216369e-11f},
+	{0.00273324984f, 0.00272579955f, 5.58106816e-11f},
+	{0.00281334059f, 0.00280544791f, 6.26454091e-11f},
+	{0.00289577822f, 0.0028874169f, 7.03171383e-11f},
+	{0.00298063149f, 0.00297177373f, 7.89283716e-11f},
+	{0.0030679712f, 0.00305858754f, 8.8594164e-11f},
+	{0.00315787021f, 0.00314792946f, 9.9443661e-11f},
+	{0.00325040351f, 0.00323987262f, 1.11621824e-10f},
+	{0.0033456483f, 0.00333449227f, 1.25291366e-10f},
+	{0.00344368405f, 0.00343186579f, 1.40634928e-10f},
+	{0.00354459253f, 0.00353207277f, 1.57857518e-10f},
+	{0.00364845792f, 0.00363519507f, 1.77189249e-10f},
+	{0.00375536689f, 0.00374131687f, 1.98888417e-10f},
+	{0.00386540862f, 0.00385052477f, 2.2324495e-10f},
+	{0.00397867492f, 0.0039629078f, 2.50584281e-10f},
+	{0.00409526028f, 0.00407855752f, 2.81271698e-10f},
+	{0.00421526196f, 0.00419756811f, 3.15717226e-10f},
+	{0.00433878009f, 0.00432003641f, 3.54381104e-10f},
+	{0.00446591772f, 0.00444606198f, 3.97779933e-10f},
+	{0.00459678092f, 0.00457574721f, 4.46493585e-10f},
+	{0.00473147886f, 0.00470919739f, 5.01172943e-10f},
+	{0.00487012394f, 0.00484652078f, 5.62548607e-10f},
+	{0.00501283182f, 0.00498782867f, 6.31440649e-10f},
+	{0.00515972157f, 0.0051332355f, 7.08769576e-10f},
+	{0.00531091576f, 0.00528285894f, 7.95568629e-10f},
+	{0.00546654052f, 0.00543681993f, 8.9299759e-10f},
+	{0.00562672572f, 0.00559524282f, 1.00235828e-09f},
+	{0.005791605f, 0.00575825546f, 1.12511195e-09f},
+	{0.00596131595f, 0.00592598925f, 1.26289882e-09f},
+	{0.00613600016f, 0.00609857927f, 1.41755999e-09f},
+	{0.0063158034f, 0.00627616438f, 1.59116204e-09f},
+	{0.00650087571f, 0.00645888728f, 1.78602466e-09f},
+	{0.00669137151f, 0.00664689467f, 2.00475161e-09f},
+	{0.00688744977f, 0.00684033729f, 2.25026559e-09f},
+	{0.00708927412f, 0.0070393701f, 2.52584722e-09f},
+	{0.00729701298f, 0.0072441523f, 2.83517894e-09f},
+	{0.00751083971f, 0.00745484754f, 3.1823942e-09f},
+	{0.00773093275f, 0.00767162394f, 3.57213269e-09f},
+	{0.0079574758f, 0.00789465428f, 4.00960237e-09f},
+	{0.00819065792f, 0.00812411606f, 4.50064909e-09f},
+	{0.00843067373f, 0.00836019168f, 5.05183466e-09f},
+	{0.00867772355f, 0.0086030685f, 5.67052464e-09f},
+	{0.00893201359f, 0.00885293902f, 6.3649867e-09f},
+	{0.0091937561f, 0.00911000098f, 7.1445012e-09f},
+	{0.00946316957f, 0.00937445749f, 8.01948519e-09f},
+	{0.0097404789f, 0.0096465172f, 9.00163168e-09f},
+	{0.0100259156f, 0.00992639438f, 1.01040659e-08f},
+	{0.0103197179f, 0.0102143091f, 1.13415209e-08f},
+	{0.0106221311f, 0.0105104873f, 1.27305343e-08f},
+	{0.0109334078f, 0.0108151612f, 1.42896694e-08f},
+	{0.0112538077f, 0.011128569f, 1.60397636e-08f},
+	{0.0115835985f, 0.0114509553f, 1.80042067e-08f},
+	{0.0119230556f, 0.0117825713f, 2.02092538e-08f},
+	{0.0122724624f, 0.012123675f, 2.2684376e-08f},
+	{0.0126321107f, 0.012474531f, 2.54626552e-08f},
+	{0.0130023009f, 0.012835411f, 2.85812257e-08f},
+	{0.0133833422f, 0.0132065939f, 3.20817712e-08f},
+	{0.013775553f, 0.0135883658f, 3.6011082e-08f},
+	{0.0141792609f, 0.0139810203f, 4.04216809e-08f},
+	{0.0145948031f, 0.0143848589f, 4.5372526e-08f},
+	{0.0150225269f, 0.0148001906f, 5.09297985e-08f},
+	{0.0154627897f, 0.0152273326f, 5.71677888e-08f},
+	{0.0159159594f, 0.0156666103f, 6.41698897e-08f},
+	{0.0163824149f, 0.0161183573f, 7.20297124e-08f},
+	{0.016862546f, 0.0165829158f, 8.08523389e-08f},
+	{0.0173567541f, 0.0170606368f, 9.07557278e-08f},
+	{0.0178654525f, 0.0175518802f, 1.01872293e-07f},
+	{0.0183890665f, 0.0180570149f, 1.14350676e-07f},
+	{0.0189280342f, 0.0185764191f, 1.28357735e-07f},
+	{0.0194828063f, 0.0191104805f, 1.44080779e-07f},
+	{0.0200538469f, 0.0196595964f, 1.61730073e-07f},
+	{0.020641634f, 0.020224174f, 1.81541657e-07f},
+	{0.0212466595f, 0.0208046306f, 2.03780503e-07f},
+	{0.0218694298f, 0.0214013935f, 2.28744067e-07f},
+	{0.0225104664f, 0.0220149007f, 2.5676627e-07f},
+	{0.0231703061f, 0.0226456006f, 2.88221971e-07f},
+	{0.0238495016f, 0.0232939525f, 3.23531993e-07f},
+	{0.0245486221f, 0.0239604266f, 3.63168759e-07f},
+	{0.0252682534f, 0.0246455046f, 4.07662625e-07f},
+	{0.0260089989f, 0.0253496791f, 4.57608986e-07f},
+	{0.0267714796f, 0.0260734547f, 5.13676266e-07f},
+	{0.0275563353f, 0.0268173475f, 5.76614874e-07f},
+	{0.0283642244f, 0.0275818856f, 6.47267274e-07f},
+	{0.0291958251f, 0.0283676093f, 7.26579288e-07f},
+	{0.0300518357f, 0.0291750713f, 8.15612786e-07f},
+	{0.0309329754f, 0.0300048365f, 9.15559941e-07f},
+	{0.0318399845f, 0.0308574827f, 1.02775924e-06f},
+	{0.0327736257f, 0.0317336005f, 1.15371345e-06f},
+	{0.0337346843f, 0.0326337935f, 1.29510983e-06f},
+	{0.0347239691f, 0.0335586785f, 1.45384277e-06f},
+	{0.035742313f, 0.0345088856f, 1.63203931e-06f},
+	{0.0367905741f, 0.0354850584f, 1.8320877e-06f},
+	{0.0378696359f, 0.0364878542f, 2.05666956e-06f},
+	{0.0389804087f, 0.0375179439f, 2.30879596e-06f},
+	{0.0401238299f, 0.0385760126f, 2.59184797e-06f},
+	{0.0413008654f, 0.0396627591f, 2.90962224e-06f},
+	{0.04251251f, 0.0407788967f, 3.26638211e-06f},
+	{0.0437597887f, 0.0419251528f, 3.66691518e-06f},
+	{0.0450437574f, 0.0431022692f, 4.11659784e-06f},
+	{0.0463655041f, 0.0443110021f, 4.62146793e-06f},
+	{0.0477261498f, 0.0455521224f, 5.18830623e-06f},
+	{0.0491268498f, 0.0468264155f, 5.8247282e-06f},
+	{0.0505687943f, 0.0481346815f, 6.53928694e-06f},
+	{0.0520532101f, 0.0494777352f, 7.34158903e-06f},
+	{0.0535813617f, 0.0508564062f, 8.24242465e-06f},
+	{0.0551545523f, 0.0522715389f, 9.25391388e-06f},
+	{0.0567741252f, 0.0537239925f, 1.03896712e-05f},
+	{0.0584414655f, 0.055214641f, 1.16649906e-05f},
+	{0.0601580009f, 0.0567443729f, 1.3097053e-05f},
+	{0.0619252038f, 0.0583140918f, 1.47051608e-05f},
+	{0.0637445922f, 0.0599247157f, 1.65110005e-05f},
+	{0.065617732f, 0.0615771773f, 1.85389385e-05f},
+	{0.0675462381f, 0.0632724239f, 2.08163541e-05f},
+	{0.0695317763f, 0.065011417f, 2.33740139e-05f},
+	{0.0715760654f, 0.0667951326f, 2.62464932e-05f},
+	{0.0736808787f, 0.0686245608f, 2.94726499e-05f},
+	{0.0758480463f, 0.0705007055f, 3.3096159e-05f},
+	{0.078079457f, 0.0724245847f, 3.71661125e-05f},
+	{0.0803770606f, 0.07439723f, 4.17376969e-05f},
+	{0.0827428704f, 0.0764196862f, 4.68729547e-05f},
+	{0.0851789651f, 0.0784930116f, 5.26416431e-05f},
+	{0.0876874918f, 0.0806182773f, 5.91222006e-05f},
+	{0.0902706685f, 0.0827965671f, 6.64028371e-05f},
+	{0.0929307871f, 0.0850289773f, 7.45827618e-05f},
+	{0.0956702159f, 0.0873166164f, 8.37735686e-05f},
+	{0.0984914034f, 0.0896606046f, 9.41007971e-05f},
+	{0.101396881f, 0.0920620738f, 0.000105705694f},
+	{0.104389267f, 0.0945221671f, 0.000118747203f},
+	{0.107471269f, 0.0970420383f, 0.000133404203f},
+	{0.110645691f, 0.0996228521f, 0.000149878048f},
+	{0.113915434f, 0.102265783f, 0.000168395422f},
+	{0.117283502f, 0.104972016f, 0.000189211573f},
+	{0.120753005f, 0.107742745f, 0.000212613967f},
+	{0.124327169f, 0.110579173f, 0.00023892642f},
+	{0.128009334f, 0.113482513f, 0.000268513765f},
+	{0.131802966f, 0.116453986f, 0.000301787146f},
+	{0.13571166f, 0.11949482f, 0.000339210002f},
+	{0.139739145f, 0.122606252f, 0.000381304848f},
+	{0.143889295f, 0.125789528f, 0.000428660964f},
+	{0.148166132f, 0.1290459f, 0.000481943112f},
+	{0.152573839f, 0.132376628f, 0.000541901422f},
+	{0.157116761f, 0.135782979f, 0.000609382626f},
+	{0.161799422f, 0.139266227f, 0.000685342812f},
+	{0.16662653f, 0.142827654f, 0.000770861931f},
+	{0.171602988f, 0.146468548f, 0.000867160293f},
+	{0.176733908f, 0.150190206f, 0.00097561736f},
+	{0.182024618f, 0.153993932f, 0.00109779314f},
+	{0.187480682f, 0.157881037f, 0.00123545263f},
+	{0.193107908f, 0.161852844f, 0.00139059363f},
+	{0.198912367f, 0.165910681f, 0.00156547863f},
+	{0.20490041f, 0.170055889f, 0.00176267121f},
+	{0.211078683f, 0.174289818f, 0.00198507767f},
+	{0.21745415f, 0.178613831f, 0.00223599487f},
+	{0.224034114f, 0.183029305f, 0.00251916499f},
+	{0.230826237f, 0.187537631f, 0.00283883851f},
+	{0.237838573f, 0.192140218f, 0.00319984661f},
+	{0.245079586f, 0.196838491f, 0.00360768454f},
+	{0.252558191f, 0.201633899f, 0.00406860788f},
+	{0.26028378f, 0.206527914f, 0.00458974354f},
+	{0.26826626f, 0.211522035f, 0.00517921833f},
+	{0.276516098f, 0.216617791f, 0.00584630781f},
+	{0.285044359f, 0.221816747f, 0.00660160911f},
+	{0.293862762f, 0.227120504f, 0.00745724182f},
+	{0.302983728f, 0.232530707f, 0.00842708199f},
+	{0.312420443f, 0.238049052f, 0.00952703528f},
+	{0.322186924f, 0.243677288f, 0.0107753563f},
+	{0.332298093f, 0.249417225f, 0.0121930231f},
+	{0.342769859f, 0.255270743f, 0.0138041765f},
+	{0.353619208f, 0.261239798f, 0.0156366382f},
+	{0.364864306f, 0.267326433f, 0.0177225217f},
+	{0.376524612f, 0.273532786f, 0.020098955f},
+	{0.388621006f, 0.279861103f, 0.0228089391f},
+	{0.401175933f, 0.286313748f, 0.0259023689f},
+	{0.414213562f, 0.292893219f, 0.0294372515f},
+	{0.427759971f, 0.29960216f, 0.0334811654f},
+	{0.441843348f, 0.306443379f, 0.038113013f},
+	{0.456494227f, 0.313419867f, 0.043425133f},
+	{0.471745752f, 0.320534815f, 0.0495258563f},
+	{0.48763398f, 0.327791638f, 0.0565426089f},
+	{0.50419822f, 0.335194001f, 0.064625696f},
+	{0.521481436f, 0.342745842f, 0.0739529343f},
+	{0.539530693f, 0.350451404f, 0.0847353496f},
+	{0.558397688f, 0.35831527f, 0.0972242154f},
+	{0.578139351f, 0.366342396f, 0.111719793f},
+	{0.598818552f, 0.374538156f, 0.12858224f},
+	{0.620504922f, 0.382908385f, 0.148245296f},
+	{0.643275815f, 0.391459431f, 0.171233564f},
+	{0.667217443f, 0.400198214f, 0.198184445f},
+	{0.692426207f, 0.409132288f, 0.229876188f},
+	{0.719010289f, 0.418269916f, 0.267263974f},
+	{0.747091546f, 0.427620148f, 0.311526709f},
+	{0.776807778f, 0.437192918f, 0.364128156f},
+	{0.808315473f, 0.446999146f, 0.426897458f},
+	{0.841793132f, 0.457050858f, 0.502136177f},
+	{0.877445336f, 0.467361323f, 0.592761897f},
+	{0.915507747f, 0.477945207f, 0.702502856f},
+	{0.956253309f, 0.488818756f, 0.836164653f},
+	{1.0f, 0.5f, 1.0f},
+	{1.04712059f, 0.511508993f, 1.20222791f},
+	{1.0980551f, 0.523368094f, 1.45377278f},
+	{1.15332673f, 0.53560229f, 1.76933237f},
+	{1.21356266f, 0.548239579f, 2.1689464f},
+	{1.27952138f, 0.561311419f, 2.68034185f},
+	{1.35212908f, 0.574853264f, 3.34250917f},
+	{1.43252892f, 0.588905197f, 4.21127496f},
+	{1.52214881f, 0.603512689f, 5.36819711f},
+	{1.62279617f, 0.61872752f, 6.9351506f},
+	{1.7367934f, 0.634608883f, 9.09897862f},
+	{1.86717585f, 0.651224741f, 12.154606f},
+	{2.01798867f, 0.668653495f, 16.5834504f},
+	{2.19474568f, 0.686986038f, 23.2026083f},
+	{2.4051634f, 0.706328337f, 33.4640383f},
+	{2.66038458f, 0.726804663f, 50.0930745f},
+	{2.97711909f, 0.748561716f, 78.5569891f},
+	{3.38162004f, 0.771773912f, 130.767323f},
+	{3.91763579f, 0.796650252f, 235.557119f},
+};
+
+/* ========== LFO ========== */
+/* sin(2*pi*x) for x in [0, 1] */
+const float sine_table[257] = {
+	0.0f, 0.0245412285f, 0.0490676743f, 0.0735645636f, 0.0980171403f, 0.122410675f, 0.146730474f, 0.170961889f,
+	0.195090322f, 0.21910124f, 0.24298018f, 0.266712757f, 0.290284677f, 0.31368174f, 0.336889853f, 0.359895037f,
+	0.382683432f, 0.405241314f, 0.427555093f, 0.44961133f, 0.471396737f, 0.492898192f, 0.514102744f, 0.53499762f,
+	0.555570233f, 0.575808191f, 0.595699304f, 0.615231591f, 0.634393284f, 0.653172843f, 0.671558955f, 0.689540545f,
+	0.707106781f, 0.724247083f, 0.740951125f, 0.757208847f, 0.773010453f, 0.788346428f, 0.803207531f, 0.817584813f,
+	0.831469612f, 0.844853565f, 0.85772861f, 0.870086991f, 0.881921264f, 0.893224301f, 0.903989293f, 0.914209756f,
+	0.923879533f, 0.932992799f, 0.941544065f, 0.949528181f, 0.956940336f, 0.963776066f, 0.970031253f, 0.97570213f,
+	0.98078528f, 0.985277642f, 0.98917651f, 0.992479535f, 0.995184727f, 0.997290457f, 0.998795456f, 0.999698819f,
+	1.0f, 0.999698819f, 0.998795456f, 0.997290457f, 0.995184727f, 0.992479535f, 0.98917651f, 0.985277642f,
+	0.98078528f, 0.97570213f, 0.970031253f, 0.963776066f, 0.956940336f, 0.949528181f, 0.941544065f, 0.932992799f,
+	0.923879533f, 0.914209756f, 0.903989293f, 0.893224301f, 0.881921264f, 0.870086991f, 0.85772861f, 0.844853565f,
+	0.831469612f, 0.817584813f, 0.803207531f, 0.788346428f, 0.773010453f, 0.757208847f, 0.740951125f, 0.724247083f,
+	0.707106781f, 0.689540545f, 0.671558955f, 0.653172843f, 0.634393284f, 0.615231591f, 0.595699304f, 0.575808191f,
+	0.555570233f, 0.53499762f, 0.514102744f, 0.492898192f, 0.471396737f, 0.44961133f, 0.427555093f, 0.405241314f,
+	0.382683432f, 0.359895037f, 0.336889853f, 0.31368174f, 0.290284677f, 0.266712757f, 0.24298018f, 0.21910124f,
+	0.195090322f, 0.170961889f, 0.146730474f, 0.122410675f, 0.0980171403f, 0.0735645636f, 0.0490676743f, 0.0245412285f,
+	1.2246468e-16f, -0.0245412285f, -0.0490676743f, -0.0735645636f, -0.0980171403f, -0.122410675f, -0.146730474f, -0.170961889f,
+	-0.195090322f, -0.21910124f, -0.24298018f, -0.266712757f, -0.290284677f, -0.31368174f, -0.336889853f, -0.359895037f,
+	-0.382683432f, -0.405241314f, -0.427555093f, -0.44961133f, -0.471396737f, -0.492898192f, -0.514102744f, -0.53499762f,
+	-0.555570233f, -0.575808191f, -0.595699304f, -0.615231591f, -0.634393284f, -0.653172843f, -0.671558955f, -0.689540545f,
+	-0.707106781f, -0.724247083f, -0.740951125f, -0.757208847f, -0.773010453f, -0.788346428f, -0.803207531f, -0.817584813f,
+	-0.831469612f, -0.844853565f, -0.85772861f, -0.870086991f, -0.881921264f, -0.893224301f, -0.903989293f, -0.914209756f,
+	-0.923879533f, -0.932992799f, -0.941544065f, -0.949528181f, -0.956940336f, -0.963776066f, -0.970031253f, -0.97570213f,
+	-0.98078528f, -0.985277642f, -0.98917651f, -0.992479535f, -0.995184727f, -0.997290457f, -0.998795456f, -0.999698819f,
+	-1.0f, -0.999698819f, -0.998795456f, -0.997290457f, -0.995184727f, -0.992479535f, -0.98917651f, -0.985277642f,
+	-0.98078528f, -0.97570213f, -0.970031253f, -0.963776066f, -0.956940336f, -0.949528181f, -0.941544065f, -0.932992799f,
+	-0.923879533f, -0.914209756f, -0.903989293f, -0.893224301f, -0.881921264f, -0.870086991f, -0.85772861f, -0.844853565f,
+	-0.831469612f, -0.817584813f, -0.803207531f, -0.788346428f, -0.773010453f, -0.757208847f, -0.740951125f, -0.724247083f,
+	-0.707106781f, -0.689540545f, -0.671558955f, -0.653172843f, -0.634393284f, -0.615231591f, -0.595699304f, -0.575808191f,
+	-0.555570233f, -0.53499762f, -0.514102744f, -0.492898192f, -0.471396737f, -0.44961133f, -0.427555093f, -0.405241314f,
+	-0.382683432f, -0.359895037f, -0.336889853f, -0.31368174f, -0.290284677f, -0.266712757f, -0.24298018f, -0.21910124f,
+	-0.195090322f, -0.170961889f, -0.146730474f, -0.122410675f, -0.0980171403f, -0.0735645636f, -0.0490676743f, -0.0245412285f,
+	-2.4492936e-16f,
+};
+
+/* ========== Oversampler ========== */
+/* Odd-phase taps of the first half-band stage (Kaiser, beta 7) */
+const float halfband_1_table[12] = {
+	0.316560102f, -0.100859613f, 0.0552394979f, -0.0343316677f, 0.0220798615f, -0.0141308582f, 0.0087871844f, -0.00520428091f,
+	0.00287075977f, -0.00142830926f, 0.000604414371f, -0.00018709155f,
+};
+/* Odd-phase taps of the second half-band stage (Kaiser, beta 6.5) */
+const float halfband_2_table[4] = {
+	0.303602367f, -0.0686739862f, 0.0174240553f, -0.00235243645f,
+};
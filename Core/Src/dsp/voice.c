@@ -0,0 +1,95 @@
+/**
+  ******************************************************************************
+  * @file    voice.c
+  * @author  Bianchi Davide
+  * @brief   This file contains the whole structure and function of a voice:
+  * 		 the oscillators, filter and envelope that play a single note.
+  ******************************************************************************
+**/
+
+#include "dsp/voice.h"
+
+/* ========== Constructor ==========*/
+void setupVoice(Voice *voice, float sr) {
+	setupOsc(&voice->osc1, sr);
+	setupOsc(&voice->osc2, sr);
+	setupFilter(&voice->filter, sr);
+	setupAdsr(&voice->adsr, sr);
+	setupOversampler(&voice->oversampler);
+	setFilterSampleRate(&voice->filter, sr * voice->oversampler.factor);
+
+	voice->midi_note 	= DEFAULT_NOTE;
+	voice->note 		= DEFAULT_NOTE;
+	voice->target_note 	= DEFAULT_NOTE;
+	voice->velocity 	= DEFAULT_VELOCITY;
+	voice->age 			= 0;
+	voice->group 		= 0;
+	voice->gate 		= false;
+	voice->active 		= false;
+}
+
+/* ========== Parameters ==========*/
+// The filter runs at sr*factor
+void setVoiceOversampling(Voice *voice, float sr, int factor) {
+	setOversamplerFactor(&voice->oversampler, factor);
+	setFilterSampleRate(&voice->filter, sr * voice->oversampler.factor);
+}
+
+void setVoiceSampleRate(Voice *voice, float sr) {
+	setOscSampleRate(&voice->osc1, sr);
+	setOscSampleRate(&voice->osc2, sr);
+	setAdsrSampleRate(&voice->adsr, sr);
+	setFilterSampleRate(&voice->filter, sr * voice->oversampler.factor);
+}
+
+/* =========== Midi ============ */
+void voiceNoteOn(Voice *voice, uint8_t midi_note, float velocity, uint32_t age) {
+	voiceSetNote(voice, midi_note);
+	voice->velocity = velocity;
+	voice->age 		= age;
+	voice->gate 	= true;
+	voice->active 	= true;
+	adsrNoteOn(&voice->adsr);	// A stolen voice restarts the attack from its current level
+}
+
+// Changes the pitch without retriggering the envelope (legato)
+void voiceSetNote(Voice *voice, uint8_t midi_note) {
+	voice->midi_note 	= midi_note;
+	voice->note 		= midi_note;
+	voice->target_note 	= midi_note;
+}
+
+// Called after the note is set: the pitch restarts from note and glides to the new one
+void voiceGlideFrom(Voice *voice, float note) {
+	voice->note = note;
+}
+
+// One step of the glide per control block, a one-pole in semitones (RC-style portamento)
+void voiceGlide(Voice *voice, float coeff) {
+	float distance = voice->target_note - voice->note;
+	if(fabsf(distance) < GLIDE_EPSILON) {
+		voice->note = voice->target_note;
+	} else {
+		voice->note += distance * coeff;
+	}
+}
+
+void voiceNoteOff(Voice *voice) {
+	voice->gate = false;
+	adsrNoteOff(&voice->adsr);
+}
+
+/* ========== Utils ==========*/
+// Frees the voice once the release is over
+void voiceCheckEnd(Voice *voice) {
+	if(voice->adsr.reset_voice == 1) {
+		voice->adsr.reset_voice = 0;
+		voice->active = false;
+		clearOscAccumulators(&voice->osc1);
+		clearOscAccumulators(&voice->osc2);
+	}
+}
+
+float getVoiceLevel(Voice *voice) {
+	return voice->active ? voice->adsr.env : 0.0f;
+}
@@ -25,6 +25,9 @@
 #include "dsp/synthesizer.h"
 #include "utils/midi_decoder.h"
 #include "driver/dac_driver.h"
+#include "driver/audio_driver.h"
+#include "driver/midi_uart.h"
+#include "utils/benchmark.h"
 
 /* USER CODE END Includes */
 
@@ -59,17 +62,7 @@ TIM_HandleTypeDef htim2;
 
 /* USER CODE BEGIN PV */
 
-volatile int endTime = 0; // Timestamp finale
-volatile int startTime = 0; // Ottenere il timestamp all'inizio del trasferimento (ad esempio, inizio della funzione di trasferimento I2S)
-volatile int elapsedTime = 0;
-volatile int interrupt = 0;
-volatile int half = 0;
-volatile int full = 0;
-volatile int process = 0;
-volatile int adc_interrupt = 0;
 
-
-uint8_t dataReadyFlag = 0;
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -86,29 +79,34 @@ void MX_USB_HOST_Process(void);
 /* USER CODE BEGIN PFP */
 void GPIO_Scanner();
 void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef* hadc);
-void USBH_MIDI_ReceiveCallback(USBH_HandleTypeDef *phost);
+void USBH_MIDI_ReceiveCallback(USBH_HandleTypeDef *phost, uint8_t *pbuff, uint16_t length, uint32_t time);
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
 
-// Synth structure
-Synthesizer synth;
+// Synth structure, in CCM RAM with the voices (see utils/memory_sections.h)
+CCM_DATA Synthesizer synth;
 
 // DAC structure
 CS43L22 dac;
 
+// Deferred rendering of the I2S buffer
+AudioDriver audio;
+
 // ADC Variables
-uint16_t adc_values[11] = {0};										// Store the adc raw values
+uint16_t adc_values[NUM_ADC_CHANNELS] = {0};										// Store the adc raw values
 int adc_channel_count = sizeof(adc_values)/sizeof(adc_values[0]);	    // Store the number of adc channels (array length)
 
 // MIDI Variables
-uint8_t midi_rx_buffer[MIDI_BUFF_SIZE]; // MIDI reception buffer
+MidiParser midi_usb;
+MidiUart midi_din;
+MidiTxQueue midi_usb_out;			// USB-MIDI output, pushMidiPacket() from any context
+uint8_t midi_rx_buffer[USBH_MIDI_RX_BUFFERS][MIDI_BUFF_SIZE]; // MIDI reception buffers, one filled by the USB while the other is decoded
 
 // Processing buffer
 //float processing_buffer[I2S_BUFFER_SIZE/4] = {0};		// BUFFER_SIZE/4
-int16_t i2s_buffer[I2S_BUFFER_SIZE] = {0};
-static volatile int16_t *buf_ptr = &i2s_buffer[0];
+int16_t i2s_buffer[I2S_BUFFER_SIZE(MAX_BUFFER_SIZE)] = {0};	// Halves of audio.frames in use, read by the DMA: never in CCM RAM
 
 /* USER CODE END 0 */
 
@@ -147,8 +145,21 @@ int main(void)
   MX_USB_HOST_Init();
   /* USER CODE BEGIN 2 */
 
-  // Setup del Synth
-  setupSynthesizer(&synth, SAMPLE_RATE);
+#ifdef SYNTH_PROFILER
+  // Before the benchmarks, they render through the profiled path. Set again with the real rate
+  setupProfiler(DEFAULT_SAMPLE_RATE);
+#endif
+#ifdef SYNTH_BENCHMARK
+  // Cycle benchmarks of the dsp, read benchmark_results with the debugger
+  runBenchmarks();
+#endif
+
+  // Setup del Synth, the audio driver sets the real rate of the PLLI2S (and the profiler)
+  setupSynthesizer(&synth, DEFAULT_SAMPLE_RATE);
+  setupAudioDriver(&audio, &synth, &hi2s3, i2s_buffer, DEFAULT_SAMPLE_RATE);
+  setupMidiParser(&midi_usb);
+  setupMidiTxQueue(&midi_usb_out);
+  setupMidiUart(&midi_din, &audio.events[MIDI_SOURCE_DIN]);
 
   CS43L22_Init(&dac, &hi2c1);
   HAL_Delay(50);
@@ -158,12 +169,12 @@ int main(void)
   HAL_TIM_Base_Start(&htim2);
 
 
-  // Trasmission to the DAC
-  HAL_I2S_Transmit_DMA(&hi2s3, (uint16_t *)i2s_buffer, I2S_BUFFER_SIZE);
-
-  // Scanning the GPIO
+  // Scanning the GPIO, before the render starts: from then on only the render writes the synth
   GPIO_Scanner();
 
+  // Trasmission to the DAC
+  startAudioDriver(&audio);
+
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -174,13 +185,8 @@ int main(void)
     MX_USB_HOST_Process();
 
     /* USER CODE BEGIN 3 */
-		MIDI_UserProcess(midi_rx_buffer);
-/*
-		if(dataReadyFlag == 1) {
-			processData();
-			dataReadyFlag = 0;
-		}
-*/
+		MIDI_UserProcess(midi_rx_buffer[0], &midi_usb_out);
+		audioDriverProcess(&audio);		// Applies a new buffer size or sample rate (requestAudio...())
 	}
 
   /* USER CODE END 3 */
@@ -556,11 +562,11 @@ static void MX_DMA_Init(void)
   __HAL_RCC_DMA2_CLK_ENABLE();
 
   /* DMA interrupt init */
-  /* DMA1_Stream5_IRQn interrupt configuration */
-  HAL_NVIC_SetPriority(DMA1_Stream5_IRQn, 0, 0);
-  HAL_NVIC_EnableIRQ(DMA1_Stream5_IRQn);
+  /* DMA1_Stream7_IRQn interrupt configuration */
+  HAL_NVIC_SetPriority(DMA1_Stream7_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream7_IRQn);
   /* DMA2_Stream0_IRQn interrupt configuration */
-  HAL_NVIC_SetPriority(DMA2_Stream0_IRQn, 0, 0);
+  HAL_NVIC_SetPriority(DMA2_Stream0_IRQn, 2, 0);
   HAL_NVIC_EnableIRQ(DMA2_Stream0_IRQn);
 
 }
@@ -625,25 +631,25 @@ static void MX_GPIO_Init(void)
   HAL_GPIO_Init(GPIOD, &GPIO_InitStruct);
 
   /* EXTI interrupt init*/
-  HAL_NVIC_SetPriority(EXTI0_IRQn, 0, 0);
+  HAL_NVIC_SetPriority(EXTI0_IRQn, 2, 0);
   HAL_NVIC_EnableIRQ(EXTI0_IRQn);
 
-  HAL_NVIC_SetPriority(EXTI1_IRQn, 0, 0);
+  HAL_NVIC_SetPriority(EXTI1_IRQn, 2, 0);
   HAL_NVIC_EnableIRQ(EXTI1_IRQn);
 
-  HAL_NVIC_SetPriority(EXTI2_IRQn, 0, 0);
+  HAL_NVIC_SetPriority(EXTI2_IRQn, 2, 0);
   HAL_NVIC_EnableIRQ(EXTI2_IRQn);
 
-  HAL_NVIC_SetPriority(EXTI3_IRQn, 0, 0);
+  HAL_NVIC_SetPriority(EXTI3_IRQn, 2, 0);
   HAL_NVIC_EnableIRQ(EXTI3_IRQn);
 
-  HAL_NVIC_SetPriority(EXTI4_IRQn, 0, 0);
+  HAL_NVIC_SetPriority(EXTI4_IRQn, 2, 0);
   HAL_NVIC_EnableIRQ(EXTI4_IRQn);
 
-  HAL_NVIC_SetPriority(EXTI9_5_IRQn, 0, 0);
+  HAL_NVIC_SetPriority(EXTI9_5_IRQn, 2, 0);
   HAL_NVIC_EnableIRQ(EXTI9_5_IRQn);
 
-  HAL_NVIC_SetPriority(EXTI15_10_IRQn, 0, 0);
+  HAL_NVIC_SetPriority(EXTI15_10_IRQn, 2, 0);
   HAL_NVIC_EnableIRQ(EXTI15_10_IRQn);
 
 /* USER CODE BEGIN MX_GPIO_Init_2 */
@@ -656,13 +662,13 @@ static void MX_GPIO_Init(void)
 void GPIO_Scanner() {
 
 	// Waveform Osc1
-	// setOscWaveform(&synth->osc1, 0);
-	setOscWaveform(&synth.osc1, 1);
-	// setOscWaveform(&synth->osc1, 2);
+	// setWaveformOsc1(&synth, 0);
+	setWaveformOsc1(&synth, 1);
+	// setWaveformOsc1(&synth, 2);
 	// Waveform Osc2
-	//setOscWaveform(&synth->osc2, 0);
-	setOscWaveform(&synth.osc2, 1);
-	//setOscWaveform(&synth->osc2, 2);
+	//setWaveformOsc2(&synth, 0);
+	setWaveformOsc2(&synth, 1);
+	//setWaveformOsc2(&synth, 2);
 
 	setMuteOsc1(&synth.mixer, 1);
 	setMuteOsc2(&synth.mixer, 0);
@@ -696,40 +702,71 @@ void GPIO_Scanner() {
 
 // All the weak functions are implemented here
 
-/* Callback after a MIDI message is received */
-void USBH_MIDI_ReceiveCallback(USBH_HandleTypeDef *phost)
+/* Callback after a MIDI transfer is received, in the main loop: the next one is already in flight */
+void USBH_MIDI_ReceiveCallback(USBH_HandleTypeDef *phost, uint8_t *pbuff, uint16_t length, uint32_t time)
 {
-	midiDecode(phost, &synth, midi_rx_buffer);	
-	USBH_MIDI_Receive(phost, midi_rx_buffer, MIDI_BUFF_SIZE); // Start a new reception after the conversion
+	UNUSED(phost);
+	midiDecode(&midi_usb, &audio.events[MIDI_SOURCE_USB], pbuff, length, time);	// Played by the audio render
+}
+
+/* Callback after a whole SysEx is received, with the transfer that ends it: the device commands */
+void midiSysExCallback(MidiParser *parser, EventQueue *queue, const uint8_t *sysex, uint16_t length, uint32_t time)
+{
+	UNUSED(parser);
+	if(length < MIDI_SYSEX_HEADER + 1 || sysex[1] != MIDI_SYSEX_ID) {
+		return;
+	}
+	const uint8_t *data = &sysex[MIDI_SYSEX_HEADER];
+	uint16_t data_length = length - MIDI_SYSEX_HEADER - 1;		// Without the F7
+
+	switch(sysex[2]) {
+		case MIDI_SYSEX_BUFFER_SIZE:	// Applied by audioDriverProcess(), clamped to [MIN_BUFFER_SIZE, MAX_BUFFER_SIZE]
+			if(data_length == 2) {
+				requestAudioBufferSize(&audio, (data[0] << 7) | data[1]);
+			}
+		break;
+		case MIDI_SYSEX_SAMPLE_RATE:	// Applied by audioDriverProcess(), only the nominal rates
+			if(data_length == 3) {
+				enum SampleRate rate = (data[0] << 14) | (data[1] << 7) | data[2];
+				if(rate == SAMPLE_RATE_32K || rate == SAMPLE_RATE_44K1 || rate == SAMPLE_RATE_48K || rate == SAMPLE_RATE_96K) {
+					requestAudioSampleRate(&audio, rate);
+				}
+			}
+		break;
+		case MIDI_SYSEX_ROUTE:			// Read by the parser of the input, a single byte store
+			if(data_length == 4 && data[0] < MIDI_SOURCE_COUNT) {
+				setMidiRoute(data[0] == MIDI_SOURCE_DIN ? &midi_din.parser : &midi_usb, data[1], data[2], data[3]);
+			}
+		break;
+		case MIDI_SYSEX_VOICE_GROUP:	// The synth belongs to the render: midiApplyEvent()
+			if(data_length == 3) {
+				pushEvent(queue, time, MIDI_EVENT_VOICE_GROUP, data[1], data[2], data[0]);
+			}
+		break;
+		default:
+			;
+	}
 }
 
 /* Callback after an interrupt from digital source is received */
 void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
 {
-	parametersChangedDigital(&synth, GPIO_Pin);
+	audioDriverLatchDigital(&audio, GPIO_Pin);	// Applied by the render, parametersChangedDigital()
 }
 
 /* Callback after a conversion with the ADC is completed */
 void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef* hadc){
-	parametersChangedAnalog(&synth, adc_values);
+	audioDriverLatchAnalog(&audio, adc_values);	// Applied by the render, parametersChangedAnalog()
 }
 
-/* Callback after a trasmission of the buffer to the DAC is half-completed */
+/* Callback after a trasmission of the buffer to the DAC is half-completed: the first half is free */
 void HAL_I2S_TxHalfCpltCallback(I2S_HandleTypeDef *hi2s) {
-	buf_ptr = &i2s_buffer[0];
-	processData();
-	//dataReadyFlag = 1;
+	audioDriverHalfDone(&audio, 0);	// Rendered in PendSV_Handler()
 }
 
-/* Callback after a trasmission of the buffer to the DAC is completed */
+/* Callback after a trasmission of the buffer to the DAC is completed: the second half is free */
 void HAL_I2S_TxCpltCallback(I2S_HandleTypeDef *hi2s) {
-	buf_ptr = &i2s_buffer[I2S_BUFFER_SIZE/2];
-	processData();
-	//dataReadyFlag = 1;
-}
-
-void processData() {
-	getSynthAudioBlock(&synth, buf_ptr);
+	audioDriverHalfDone(&audio, 1);
 }
 
 /* USER CODE END 4 */
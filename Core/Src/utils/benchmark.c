@@ -0,0 +1,197 @@
+/**
+  ******************************************************************************
+  * @file    benchmark.c
+  * @author  Bianchi Davide
+  * @brief   This file contains the cycle benchmarks of the dsp components.
+  * 		 They run once at boot, before the audio starts, with the
+  * 		 interrupts disabled so that every measure is undisturbed.
+  ******************************************************************************
+**/
+
+#include "utils/benchmark.h"
+
+#ifdef SYNTH_BENCHMARK
+
+#include "dsp/blit.h"
+#include "dsp/synthesizer.h"
+
+volatile BenchmarkResults benchmark_results;
+
+CCM_DATA static Blit bench_blit;			// Same memory as the synth in main.c
+CCM_DATA static Synthesizer bench_synth;
+static float bench_buffer[DEFAULT_BUFFER_SIZE];
+static int16_t bench_output[MAX_BUFFER_SIZE * 2];
+static const float bench_frequencies[] = {110.0f, 440.0f, 1760.0f};
+#define BENCH_FREQUENCIES (sizeof(bench_frequencies)/sizeof(bench_frequencies[0]))
+
+static float measureSynthBlock(int frames);
+
+/* ========== Benchmarks ========== */
+void runBenchmarks(void) {
+	cycleCounterInit();
+	benchmarkBlit();
+	benchmarkVoices();
+	benchmarkSaturators();
+	benchmarkControlRate();
+	benchmarkOversampling();
+	benchmarkBufferSizes();
+}
+
+void benchmarkBlit(void) {
+	uint32_t start, sample_cycles, block_cycles;
+
+	for (int waveform = TRIANGLE; waveform <= SQUARE; waveform++) {
+		sample_cycles = 0;
+		block_cycles = 0;
+
+		for (size_t n = 0; n < BENCH_FREQUENCIES; n++) {
+			float f = bench_frequencies[n];
+
+			// Per-sample path
+			setupBlit(&bench_blit, DEFAULT_SAMPLE_RATE);
+			__disable_irq();
+			start = cycleCounterGet();
+			for (int b = 0; b < BENCHMARK_BLOCKS; b++) {
+				for (int i = 0; i < DEFAULT_BUFFER_SIZE; i++) {
+					bench_buffer[i] = getBlitSample(&bench_blit, f, waveform);
+				}
+			}
+			sample_cycles += cycleCounterGet() - start;
+			__enable_irq();
+
+			// Block path
+			setupBlit(&bench_blit, DEFAULT_SAMPLE_RATE);
+			__disable_irq();
+			start = cycleCounterGet();
+			for (int b = 0; b < BENCHMARK_BLOCKS; b++) {
+				getBlitAudioBlock(&bench_blit, f, waveform, bench_buffer, DEFAULT_BUFFER_SIZE);
+			}
+			block_cycles += cycleCounterGet() - start;
+			__enable_irq();
+		}
+
+		benchmark_results.blit_sample_cycles[waveform] = (float)sample_cycles / (BENCH_FREQUENCIES * BENCHMARK_BLOCKS * DEFAULT_BUFFER_SIZE);
+		benchmark_results.blit_block_cycles[waveform]  = (float)block_cycles  / (BENCH_FREQUENCIES * BENCHMARK_BLOCKS * DEFAULT_BUFFER_SIZE);
+	}
+}
+
+// Worst case voice: both oscillators on, filter and envelope always running
+void benchmarkVoices(void) {
+	setupSynthesizer(&bench_synth, DEFAULT_SAMPLE_RATE);
+	bench_synth.mute_osc1 = 1;
+	bench_synth.mute_osc2 = 1;
+	benchmark_results.synth_idle_cycles = measureSynthBlock(DEFAULT_BUFFER_SIZE);
+
+	for (int v = 0; v < NUM_VOICES; v++) {
+		synthesizerNoteOn(&bench_synth, 0, 48 + 5 * v, 1.0f);
+	}
+	float full_cycles = measureSynthBlock(DEFAULT_BUFFER_SIZE);
+
+	benchmark_results.voice_cycles = (full_cycles - benchmark_results.synth_idle_cycles) / NUM_VOICES;
+	benchmark_results.block_budget_cycles = (float)SystemCoreClock * DEFAULT_BUFFER_SIZE / DEFAULT_SAMPLE_RATE;
+	benchmark_results.max_voices = (benchmark_results.block_budget_cycles - benchmark_results.synth_idle_cycles) / benchmark_results.voice_cycles;
+}
+
+// Same load as benchmarkVoices(), with every saturator in the filter
+void benchmarkSaturators(void) {
+	setupSynthesizer(&bench_synth, DEFAULT_SAMPLE_RATE);
+	bench_synth.mute_osc1 = 1;
+	bench_synth.mute_osc2 = 1;
+	setResonance(&bench_synth, 4095);	// Drive the feedback hard
+	for (int v = 0; v < NUM_VOICES; v++) {
+		synthesizerNoteOn(&bench_synth, 0, 48 + 5 * v, 1.0f);
+	}
+
+	for (int s = 0; s < SATURATOR_COUNT; s++) {
+		setSaturator(&bench_synth, s);
+		benchmark_results.saturator_block_cycles[s] = measureSynthBlock(DEFAULT_BUFFER_SIZE);
+
+		float max_error = 0.0f;
+		for (float x = -8.0f; x <= 8.0f; x += 0.001f) {
+			float error = fabsf(saturate(s, x) - tanhf(x));
+			max_error = error > max_error ? error : max_error;
+		}
+		benchmark_results.saturator_max_error[s] = max_error;
+	}
+	setSaturator(&bench_synth, DEFAULT_SATURATOR);
+}
+
+// Same load as benchmarkVoices(), with the modulations refreshed every 1 to 32 samples
+void benchmarkControlRate(void) {
+	setupSynthesizer(&bench_synth, DEFAULT_SAMPLE_RATE);
+	bench_synth.mute_osc1 = 1;
+	bench_synth.mute_osc2 = 1;
+	synthesizerControllerChange(&bench_synth, 1, 0.5f);	// Modulation wheel
+	bench_synth.is_tremolo_mod_on = true;
+	bench_synth.is_vibrato_mod_on = true;
+	bench_synth.is_filter_mod_on = true;
+	for (int v = 0; v < NUM_VOICES; v++) {
+		synthesizerNoteOn(&bench_synth, 0, 48 + 5 * v, 1.0f);
+	}
+
+	float default_cycles = 0.0f;
+	for (int n = 0; n < BENCHMARK_CONTROL_SIZES; n++) {
+		setControlBlockSize(&bench_synth, 1 << n);
+		benchmark_results.control_block_cycles[n] = measureSynthBlock(DEFAULT_BUFFER_SIZE);
+		if ((1 << n) == DEFAULT_CONTROL_BLOCK_SIZE) {
+			default_cycles = benchmark_results.control_block_cycles[n];
+		}
+	}
+	benchmark_results.control_saving_cycles = benchmark_results.control_block_cycles[0] - default_cycles;
+}
+
+// Same load as benchmarkVoices(), with the filter at 1, 2 and 4 times the sample rate
+void benchmarkOversampling(void) {
+	setupSynthesizer(&bench_synth, DEFAULT_SAMPLE_RATE);
+	bench_synth.mute_osc1 = 1;
+	bench_synth.mute_osc2 = 1;
+	float idle_cycles = measureSynthBlock(DEFAULT_BUFFER_SIZE);
+	for (int v = 0; v < NUM_VOICES; v++) {
+		synthesizerNoteOn(&bench_synth, 0, 48 + 5 * v, 1.0f);
+	}
+
+	float budget_cycles = (float)SystemCoreClock * DEFAULT_BUFFER_SIZE / DEFAULT_SAMPLE_RATE;
+	for (int n = 0; n < 3; n++) {
+		int factor = 1 << n;
+		if (factor > OVERSAMPLING_MAX) {
+			break;
+		}
+		setOversampling(&bench_synth, factor);
+		float voice_cycles = (measureSynthBlock(DEFAULT_BUFFER_SIZE) - idle_cycles) / NUM_VOICES;
+		benchmark_results.oversampling_voice_cycles[n] = voice_cycles;
+		benchmark_results.oversampling_max_voices[n] = (budget_cycles - idle_cycles) / voice_cycles;
+	}
+}
+
+// Same load as benchmarkVoices(), with every latency: the cost of a block is amortized on more frames
+void benchmarkBufferSizes(void) {
+	setupSynthesizer(&bench_synth, DEFAULT_SAMPLE_RATE);
+	bench_synth.mute_osc1 = 1;
+	bench_synth.mute_osc2 = 1;
+	for (int v = 0; v < NUM_VOICES; v++) {
+		synthesizerNoteOn(&bench_synth, 0, 48 + 5 * v, 1.0f);
+	}
+
+	for (int n = 0; n < BENCHMARK_BUFFER_SIZES; n++) {
+		int frames = MIN_BUFFER_SIZE << n;
+		benchmark_results.buffer_frame_cycles[n] = measureSynthBlock(frames) / frames;
+	}
+}
+
+/* ========== Private functions ========== */
+// Cycles per call of getSynthAudioBlock()
+static float measureSynthBlock(int frames) {
+	uint32_t start, cycles;
+
+	__disable_irq();
+	start = cycleCounterGet();
+	for (int b = 0; b < BENCHMARK_BLOCKS; b++) {
+		getSynthAudioBlock(&bench_synth, bench_output, frames);
+	}
+	cycles = cycleCounterGet() - start;
+	__enable_irq();
+
+	return (float)cycles / BENCHMARK_BLOCKS;
+}
+
+#endif /* SYNTH_BENCHMARK */
@@ -0,0 +1,53 @@
+/**
+  ******************************************************************************
+  * @file    event_queue.c
+  * @author  Bianchi Davide
+  * @brief   This file contains the lock-free queue between the MIDI input
+  * 		 (producer) and the audio render (consumer).
+  ******************************************************************************
+**/
+
+#include "utils/event_queue.h"
+
+/* ========== Constructor ========== */
+void setupEventQueue(EventQueue *queue) {
+	queue->head 	 = 0;
+	queue->tail 	 = 0;
+	queue->overflows = 0;
+}
+
+/* ========== Producer ========== */
+// False when the queue is full: the event is dropped, the queued ones keep their timing
+bool pushEvent(EventQueue *queue, uint32_t time, uint8_t status, uint8_t data_byte_1, uint8_t data_byte_2, uint8_t group) {
+	uint32_t head = queue->head;
+	if(head - queue->tail >= EVENT_QUEUE_SIZE) {
+		queue->overflows++;
+		return false;
+	}
+
+	SynthEvent *event = &queue->events[head & (EVENT_QUEUE_SIZE - 1)];
+	event->time 		= time;
+	event->status 		= status;
+	event->data_byte_1 	= data_byte_1;
+	event->data_byte_2 	= data_byte_2;
+	event->group 		= group;
+	__DMB();					// The event is written before the consumer can see it
+	queue->head = head + 1;
+	return true;
+}
+
+/* ========== Consumer ========== */
+// Oldest event, NULL when the queue is empty. It stays valid until popEvent()
+SynthEvent *peekEvent(EventQueue *queue) {
+	uint32_t tail = queue->tail;
+	if(tail == queue->head) {
+		return NULL;
+	}
+	__DMB();					// The event is read after the head that published it
+	return &queue->events[tail & (EVENT_QUEUE_SIZE - 1)];
+}
+
+void popEvent(EventQueue *queue) {
+	__DMB();					// The event is consumed before the producer can reuse its slot
+	queue->tail = queue->tail + 1;
+}
@@ -0,0 +1,114 @@
+/**
+  ******************************************************************************
+  * @file    governor.c
+  * @author  Bianchi Davide
+  * @brief   This file contains the adaptive quality of the synth: the level
+  *          goes down at once on an underrun or above GOVERNOR_MAX_LOAD, and
+  *          back up only after GOVERNOR_UP_TIME below GOVERNOR_MIN_LOAD.
+  ******************************************************************************
+**/
+
+#include "utils/governor.h"
+
+/* ========== Private functions ========== */
+static void setGovernorLevel(Governor *governor, Synthesizer *synth, int level);
+
+/* ========== Constructor ========== */
+void setupGovernor(Governor *governor) {
+	governor->enabled 		= DEFAULT_GOVERNOR;
+	governor->level 		= 0;
+	governor->timer 		= 0.0f;
+	governor->load 			= 0.0f;
+	governor->steps_down 	= 0;
+	governor->steps_up 		= 0;
+}
+
+/* ========== Parameters ========== */
+// Disabling it gives back the full quality
+void setGovernorEnabled(Governor *governor, Synthesizer *synth, bool enabled) {
+	if(!enabled) {
+		setGovernorLevel(governor, synth, 0);
+	}
+	governor->enabled = enabled;
+}
+
+/* ========== Processing ========== */
+// load: render cycles over the half-buffer period of the block just rendered
+void updateGovernor(Governor *governor, Synthesizer *synth, float load, bool underrun, float block_time) {
+	governor->load = load;
+	if(!governor->enabled) {
+		return;
+	}
+	governor->timer += block_time;
+
+	if(underrun || load > GOVERNOR_MAX_LOAD) {
+		if(governor->level < GOVERNOR_LEVELS && governor->timer >= GOVERNOR_DOWN_TIME) {
+			setGovernorLevel(governor, synth, governor->level + 1);
+			governor->steps_down++;
+			return;
+		}
+	} else if(load < GOVERNOR_MIN_LOAD) {
+		if(governor->level > 0 && governor->timer >= GOVERNOR_UP_TIME) {
+			setGovernorLevel(governor, synth, governor->level - 1);
+			governor->steps_up++;
+		}
+		return;
+	}
+	// No headroom: the time below GOVERNOR_MIN_LOAD restarts, a step down stays allowed
+	governor->timer = governor->timer < GOVERNOR_DOWN_TIME ? governor->timer : GOVERNOR_DOWN_TIME;
+}
+
+/* ========== Private functions ========== */
+static void setGovernorLevel(Governor *governor, Synthesizer *synth, int level) {
+	if(level == governor->level) {
+		return;
+	}
+	if(governor->level == 0) {
+		governor->oversampling 		 = synth->oversampling;
+		governor->saturator 		 = synth->saturator;
+		governor->control_block_size = synth->modulation.block_size;
+		governor->voice_limit 		 = synth->voice_limit;
+	} else {
+		// Changed by the user since the last step: saved in place of the setting of level 0
+		if(synth->oversampling != governor->applied_oversampling) {
+			governor->oversampling = synth->oversampling;
+		}
+		if(synth->saturator != governor->applied_saturator) {
+			governor->saturator = synth->saturator;
+		}
+		if(synth->modulation.block_size != governor->applied_control_block_size) {
+			governor->control_block_size = synth->modulation.block_size;
+		}
+		if(synth->voice_limit != governor->applied_voice_limit) {
+			governor->voice_limit = synth->voice_limit;
+		}
+	}
+
+	// Only what changes is set: a new oversampling factor clears the filter history
+	int oversampling 		= level >= 1 ? 1 : governor->oversampling;
+	enum Saturator saturator = level >= 2 ? GOVERNOR_SATURATOR : governor->saturator;
+	int control_block_size 	= level >= 3 ? MAX_CONTROL_BLOCK_SIZE : governor->control_block_size;
+	int voice_limit 		= level >= 5 ? 1 : level == 4 ? governor->voice_limit / 2 : governor->voice_limit;
+
+	if(synth->oversampling != oversampling) {
+		setOversampling(synth, oversampling);
+	}
+	if(synth->saturator != saturator) {
+		setSaturator(synth, saturator);
+	}
+	if(synth->modulation.block_size != control_block_size) {
+		setControlBlockSize(synth, control_block_size);
+	}
+	if(synth->voice_limit != voice_limit) {
+		setVoiceLimit(synth, voice_limit);
+	}
+
+	// Read back, the setters may clamp
+	governor->applied_oversampling 		 = synth->oversampling;
+	governor->applied_saturator 		 = synth->saturator;
+	governor->applied_control_block_size = synth->modulation.block_size;
+	governor->applied_voice_limit 		 = synth->voice_limit;
+
+	governor->level = level;
+	governor->timer = 0.0f;
+}
@@ -9,58 +9,186 @@
 
 #include "utils/midi_decoder.h"
 
+/* ========== Private functions ========== */
+typedef void (*MidiPacketHandler)(MidiParser *parser, EventQueue *queue, const uint8_t *packet, uint32_t time);
+
+static void parseIgnore(MidiParser *parser, EventQueue *queue, const uint8_t *packet, uint32_t time);
+static void parseSysEx(MidiParser *parser, EventQueue *queue, const uint8_t *packet, uint32_t time);
+static void parseChannel(MidiParser *parser, EventQueue *queue, const uint8_t *packet, uint32_t time);
+static void parseSingleByte(MidiParser *parser, EventQueue *queue, const uint8_t *packet, uint32_t time);
+static void parseRealTime(MidiParser *parser, EventQueue *queue, uint8_t byte, uint32_t time);
+static void appendSysEx(MidiParser *parser, const uint8_t *bytes, int count);
+
+// Indexed by the Code Index Number
+static const MidiPacketHandler cin_handlers[16] = {
+	parseIgnore,		// 0x0 Reserved (miscellaneous)
+	parseIgnore,		// 0x1 Reserved (cable events)
+	parseIgnore,		// 0x2 System common, 2 bytes
+	parseIgnore,		// 0x3 System common, 3 bytes
+	parseSysEx,			// 0x4 SysEx start or continue, 3 bytes
+	parseSysEx,			// 0x5 SysEx end with 1 byte, or single-byte system common
+	parseSysEx,			// 0x6 SysEx end with 2 bytes
+	parseSysEx,			// 0x7 SysEx end with 3 bytes
+	parseChannel,		// 0x8 Note Off
+	parseChannel,		// 0x9 Note On
+	parseIgnore,		// 0xA Poly Key Pressure
+	parseChannel,		// 0xB Control Change
+	parseIgnore,		// 0xC Program Change
+	parseIgnore,		// 0xD Channel Pressure
+	parseChannel,		// 0xE Pitch Bend
+	parseSingleByte		// 0xF Single byte (real time)
+};
+
+// MIDI bytes carried by the SysEx CINs (0x4 to 0x7)
+static const uint8_t sysex_bytes[4] = {3, 1, 2, 3};
+
+// Data bytes of the channel messages, from 0x8 to 0xE
+static const uint8_t channel_data_bytes[7] = {2, 2, 2, 2, 1, 1, 2};
+
+/* ========== Constructor ========== */
+void setupMidiParser(MidiParser *parser) {
+	setMidiFilter(parser, DEFAULT_MIDI_CABLES, DEFAULT_MIDI_CHANNELS);
+	setMidiPlayoutDelay(parser, DEFAULT_MIDI_PLAYOUT_DELAY);
+	memset(parser->routes, DEFAULT_MIDI_GROUP, sizeof(parser->routes));
+	parser->frame_cycles 	= SystemCoreClock / MIDI_USB_FRAME_RATE;
+	parser->last_time 		= 0;
+	parser->sysex_length 	= 0;
+	parser->sysex_overflow 	= false;
+	parser->running_status 	= 0;
+	parser->data_count 		= 0;
+	parser->clock_ticks 	= 0;
+	parser->clock_time 		= 0;
+	parser->running 		= false;
+	parser->sensing_time 	= 0;
+	parser->packets 		= 0;
+	parser->filtered 		= 0;
+	parser->dropped_sysex 	= 0;
+}
+
+void setMidiFilter(MidiParser *parser, uint16_t cable_mask, uint16_t channel_mask) {
+	parser->cable_mask 	 = cable_mask;
+	parser->channel_mask = channel_mask;
+}
+
+// Notes of a cable (0 for the DIN) and channel (1 to 16) played on a voice group
+void setMidiRoute(MidiParser *parser, uint8_t cable, uint8_t channel, uint8_t group) {
+	parser->routes[cable & 0x0F][(channel - 1) & 0x0F] = group % NUM_VOICE_GROUPS;
+}
+
+// Fixed latency of the USB events: at least a frame (the spread) plus the time of the
+// transfer and of its decode, or the first events of a transfer play late (at a block start)
+void setMidiPlayoutDelay(MidiParser *parser, float delay_ms) {
+	parser->playout_cycles = (uint32_t)(delay_ms * (SystemCoreClock / 1000));
+}
+
 /* ======= MIDI Functions Wrapper ======*/
-void midiDecode(USBH_HandleTypeDef *phost, Synthesizer *synth, uint8_t *midi_rx_buffer)
+// Parses a USB transfer in place, time is the SOF of its frame (stamped by the OTG_FS interrupt).
+// The packets were sent during the frame before: they are spread back over it at even steps,
+// the last one at the SOF, then the channel messages are queued playout_cycles later
+void midiDecode(MidiParser *parser, EventQueue *queue, const uint8_t *buffer, uint16_t length, uint32_t time)
 {
-	uint16_t number_of_packets;
-	uint8_t *ptr = midi_rx_buffer;
-	midi_package_t packet;
-
-	number_of_packets = USBH_MIDI_GetLastReceivedDataSize(phost) / 4; // Each USB midi package is 4 bytes long
-
-	while (number_of_packets--)
-	{
-		packet.usb_byte = *ptr;
-		ptr++;
-		packet.status_byte = *ptr;
-		ptr++;
-		packet.data_byte_1 = *ptr;
-		ptr++;
-		packet.data_byte_2 = *ptr;
-		ptr++;
-
-		switch(packet.status_byte & 0xF0) {
-			case 0x80:	// NoteOff
-				midiDecodeNoteOff(synth, packet.data_byte_1, packet.data_byte_2);
-			break;
-			case 0x90:	// NoteOn
-				midiDecodeNoteOn(synth, packet.data_byte_1, packet.data_byte_2);
-			break;
-			case 0xB0:	// Controller Change
-				midiDecodeControllerChange(synth, packet.data_byte_1, packet.data_byte_2);
-			break;
-			case 0xE0:	// Pitch Bend
-				midiDecodePitchBend(synth, packet.data_byte_1, packet.data_byte_2);
-			break;
-			default:
-				;
+	const uint8_t *end = buffer + (length & ~(MIDI_PACKET_SIZE - 1));
+	uint32_t count = length / MIDI_PACKET_SIZE;
+	uint32_t start = time - parser->frame_cycles;
+	if(time - parser->last_time < parser->frame_cycles) {
+		start = parser->last_time;		// Another transfer less than a frame ago: after its packets, the order is kept
+	}
+	uint32_t step = count > 0 ? (time - start) / count : 0;
+	uint32_t packet_time = start + parser->playout_cycles;
+	parser->last_time = time;
+
+	for(const uint8_t *packet = buffer; packet < end; packet += MIDI_PACKET_SIZE) {
+		packet_time += step;
+		if(!(parser->cable_mask & (1 << (packet[0] >> 4)))) {
+			parser->filtered++;
+			continue;
 		}
+		cin_handlers[packet[0] & 0x0F](parser, queue, packet, packet_time);
+	}
+	parser->packets += count;
+}
+
+// Rebuilds the messages of a DIN byte stream, time is the arrival of the byte
+void midiDecodeByte(MidiParser *parser, EventQueue *queue, uint8_t byte, uint32_t time)
+{
+	if(byte >= 0xF8) {					// Real time, even between two data bytes
+		parseRealTime(parser, queue, byte, time);
+		return;
+	}
+	if(byte & 0x80) {
+		parser->running_status 	= byte < 0xF0 ? byte : 0;	// SysEx and system common cancel it
+		parser->data_count 		= 0;
+		return;
+	}
+	if(parser->running_status == 0) {
+		return;							// Data of a SysEx or a system common
+	}
+
+	uint8_t cin = parser->running_status >> 4;		// Same as the status nibble for the channel messages
+	uint8_t length = channel_data_bytes[cin - 0x8];
+	parser->data[parser->data_count++] = byte;
+	if(parser->data_count < length) {
+		return;
+	}
+	parser->data_count = 0;				// The status stays for the next message
+
+	uint8_t packet[MIDI_PACKET_SIZE] = {cin, parser->running_status, parser->data[0], length == 2 ? parser->data[1] : 0};
+	cin_handlers[cin](parser, queue, packet, time);
+	parser->packets++;
+}
+
+// Called by midiDecode() in the main loop with a whole SysEx, F0 and F7 included.
+// What changes the synth goes through the queue, at the time of the SysEx end
+__weak void midiSysExCallback(MidiParser *parser, EventQueue *queue, const uint8_t *sysex, uint16_t length, uint32_t time)
+{
+	UNUSED(parser);
+	UNUSED(queue);
+	UNUSED(sysex);
+	UNUSED(length);
+	UNUSED(time);
+}
+
+// Called by the audio render at the sample offset of the event
+void midiApplyEvent(Synthesizer *synth, SynthEvent *event)
+{
+	switch(event->status & 0xF0) {
+		case 0x80:	// NoteOff
+			midiDecodeNoteOff(synth, event->group, event->data_byte_1, event->data_byte_2);
+		break;
+		case 0x90:	// NoteOn
+			midiDecodeNoteOn(synth, event->group, event->data_byte_1, event->data_byte_2);
+		break;
+		case 0xB0:	// Controller Change
+			midiDecodeControllerChange(synth, event->data_byte_1, event->data_byte_2);
+		break;
+		case 0xE0:	// Pitch Bend
+			midiDecodePitchBend(synth, event->data_byte_1, event->data_byte_2);
+		break;
+		case 0xF0:
+			if(event->status == MIDI_EVENT_VOICE_GROUP) {	// Device SysEx, see midiSysExCallback()
+				setVoiceGroup(synth, event->group, event->data_byte_1, event->data_byte_2);
+			} else {										// System Reset
+				synthesizerAllNotesOff(synth);
+			}
+		break;
+		default:
+			;
 	}
 }
 
 /* ========== MIDI Functions ==========*/
-void midiDecodeNoteOff(Synthesizer *synth, uint8_t data_byte_1, uint8_t data_byte_2) {
-	//float midi_note = data_byte_1;
-	float hertz_note = hertz_notes[data_byte_1-21];
+void midiDecodeNoteOff(Synthesizer *synth, uint8_t group, uint8_t data_byte_1, uint8_t data_byte_2) {
 	float velocity = data_byte_2 * 0.007874; 			// data_byte_2 / 127.0;   [0, 1]
-	synthesizerNoteOff(synth, hertz_note, velocity);
+	synthesizerNoteOff(synth, group, data_byte_1, velocity);
 }
 
-void midiDecodeNoteOn(Synthesizer *synth, uint8_t data_byte_1, uint8_t data_byte_2) {
-	// float midi_note = data_byte_1;
-	float hertz_note = hertz_notes[data_byte_1-21];
+void midiDecodeNoteOn(Synthesizer *synth, uint8_t group, uint8_t data_byte_1, uint8_t data_byte_2) {
+	if(data_byte_2 == 0) {								// NoteOn with velocity 0 is a NoteOff
+		midiDecodeNoteOff(synth, group, data_byte_1, data_byte_2);
+		return;
+	}
 	float velocity = data_byte_2 * 0.007874; 			// [0, 1]
-	synthesizerNoteOn(synth, hertz_note, velocity);
+	synthesizerNoteOn(synth, group, data_byte_1, velocity);
 }
 
 void midiDecodeControllerChange(Synthesizer *synth, uint8_t data_byte_1, uint8_t data_byte_2) {
@@ -75,5 +203,93 @@ void midiDecodePitchBend(Synthesizer *synth, uint8_t data_byte_1, uint8_t data_b
 	synthesizerPitchBend(synth, pitch_bend);
 }
 
+/* ========== Packet handlers ==========*/
+static void parseIgnore(MidiParser *parser, EventQueue *queue, const uint8_t *packet, uint32_t time) {
+	UNUSED(parser);
+	UNUSED(queue);
+	UNUSED(packet);
+	UNUSED(time);
+}
 
+// CIN 0x8-0xE: the status byte carries the channel
+static void parseChannel(MidiParser *parser, EventQueue *queue, const uint8_t *packet, uint32_t time) {
+	if(!(parser->channel_mask & (1 << (packet[1] & 0x0F)))) {
+		parser->filtered++;
+		return;
+	}
+	pushEvent(queue, time, packet[1], packet[2], packet[3], parser->routes[packet[0] >> 4][packet[1] & 0x0F]);
+}
+
+// CIN 0x4-0x7. An F0 restarts the reassembly, the CINs 0x5-0x7 end it
+static void parseSysEx(MidiParser *parser, EventQueue *queue, const uint8_t *packet, uint32_t time) {
+	uint8_t cin = packet[0] & 0x0F;
+	if(cin == 0x5 && packet[1] != 0xF7) {
+		return;					// Single-byte system common (Tune Request)
+	}
+	if(packet[1] == 0xF0) {
+		parser->sysex_length 	= 0;
+		parser->sysex_overflow 	= false;
+	} else if(parser->sysex_length == 0) {
+		return;					// The start was lost or filtered
+	}
 
+	appendSysEx(parser, &packet[1], sysex_bytes[cin - 0x4]);
+	if(cin == 0x4) {
+		return;
+	}
+
+	if(parser->sysex_overflow) {
+		parser->dropped_sysex++;
+	} else {
+		midiSysExCallback(parser, queue, parser->sysex, parser->sysex_length, time);
+	}
+	parser->sysex_length = 0;
+}
+
+// CIN 0xF: real time, or a data byte of a SysEx sent one byte at a time
+static void parseSingleByte(MidiParser *parser, EventQueue *queue, const uint8_t *packet, uint32_t time) {
+	if(packet[1] >= 0xF8) {
+		parseRealTime(parser, queue, packet[1], time);
+	} else if(packet[1] < 0x80 && parser->sysex_length != 0) {
+		appendSysEx(parser, &packet[1], 1);
+	}
+}
+
+// Handled here without the queue. A reset also ends the notes, in order with them
+static void parseRealTime(MidiParser *parser, EventQueue *queue, uint8_t byte, uint32_t time) {
+	switch(byte) {
+		case 0xF8:	// Timing Clock
+			parser->clock_ticks++;
+			parser->clock_time = time;
+		break;
+		case 0xFA:	// Start
+			parser->clock_ticks = 0;
+			parser->running = true;
+		break;
+		case 0xFB:	// Continue
+			parser->running = true;
+		break;
+		case 0xFC:	// Stop
+			parser->running = false;
+		break;
+		case 0xFE:	// Active Sensing
+			parser->sensing_time = time;
+		break;
+		case 0xFF:	// System Reset
+			parser->running = false;
+			parser->sysex_length = 0;
+			pushEvent(queue, time, byte, 0, 0, 0);
+		break;
+		default:	// Undefined
+			;
+	}
+}
+
+static void appendSysEx(MidiParser *parser, const uint8_t *bytes, int count) {
+	if(parser->sysex_overflow || parser->sysex_length + count > MIDI_SYSEX_SIZE) {
+		parser->sysex_overflow = true;	// The length stays non-zero until the end
+		return;
+	}
+	memcpy(&parser->sysex[parser->sysex_length], bytes, count);
+	parser->sysex_length += count;
+}
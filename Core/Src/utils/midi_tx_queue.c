@@ -0,0 +1,98 @@
+/**
+  ******************************************************************************
+  * @file    midi_tx_queue.c
+  * @author  Bianchi Davide
+  * @brief   This file contains the lock-free queue of the USB-MIDI output,
+  * 		 between any context (producers) and the USB host (consumer).
+  ******************************************************************************
+**/
+
+#include "utils/midi_tx_queue.h"
+
+/* ========== Private functions ========== */
+static uint8_t getPacketCin(uint8_t status);
+
+/* ========== Constructor ========== */
+void setupMidiTxQueue(MidiTxQueue *queue) {
+	for(uint32_t i = 0; i < MIDI_TX_QUEUE_SIZE; i++) {
+		queue->packets[i] = 0;
+	}
+	queue->head 	 = 0;
+	queue->tail 	 = 0;
+	queue->overflows = 0;
+}
+
+/* ========== Producers ========== */
+// One message of up to 3 bytes (channel, system common, real time), SysEx is refused.
+// False when the queue is full: the caller decides to retry or drop (back-pressure)
+bool pushMidiPacket(MidiTxQueue *queue, uint8_t cable, uint8_t status, uint8_t data_byte_1, uint8_t data_byte_2) {
+	uint8_t cin = getPacketCin(status);
+	if(cin == 0) {
+		return false;
+	}
+
+	uint32_t head;
+	do {
+		head = __LDREXW(&queue->head);
+		if(head - queue->tail >= MIDI_TX_QUEUE_SIZE) {
+			__CLREX();
+			queue->overflows++;
+			return false;
+		}
+	} while(__STREXW(head + 1, &queue->head));	// Fails if another producer (an interrupt) got in between
+
+	queue->packets[head & (MIDI_TX_QUEUE_SIZE - 1)] = ((cable & 0x0F) << 4 | cin) | status << 8 | data_byte_1 << 16 | (uint32_t)data_byte_2 << 24;
+	return true;
+}
+
+// Free packets, to check before a message longer than one packet
+uint32_t getMidiTxSpace(MidiTxQueue *queue) {
+	return MIDI_TX_QUEUE_SIZE - (queue->head - queue->tail);
+}
+
+/* ========== Consumer ========== */
+// Copies the packets in order, up to size bytes (a USB transfer). Returns the bytes written
+uint16_t popMidiPackets(MidiTxQueue *queue, uint8_t *buffer, uint16_t size) {
+	uint32_t tail = queue->tail;
+	uint16_t length = 0;
+
+	while(length + sizeof(uint32_t) <= size && tail != queue->head) {
+		uint32_t slot = tail & (MIDI_TX_QUEUE_SIZE - 1);
+		uint32_t packet = queue->packets[slot];
+		if(packet == 0) {
+			break;						// Reserved by a producer that has been preempted, it goes in the next transfer
+		}
+		queue->packets[slot] = 0;
+		buffer[length++] = packet;
+		buffer[length++] = packet >> 8;
+		buffer[length++] = packet >> 16;
+		buffer[length++] = packet >> 24;
+		tail++;
+	}
+
+	__DMB();							// The slots are free before the producers can see the tail
+	queue->tail = tail;
+	return length;
+}
+
+/* ========== Private functions ========== */
+// Code Index Number of a single packet message (see midi_decoder.h), 0 for the others
+static uint8_t getPacketCin(uint8_t status) {
+	if(status < 0x80) {
+		return 0;						// Not a status byte
+	}
+	if(status < 0xF0) {
+		return status >> 4;				// Channel messages: same as the status nibble
+	}
+	switch(status) {
+		case 0xF1:	// MTC quarter frame
+		case 0xF3:	// Song select
+			return 0x2;
+		case 0xF2:	// Song position
+			return 0x3;
+		case 0xF6:	// Tune request
+			return 0x5;
+		default:
+			return status >= 0xF8 ? 0xF : 0;	// Real time, one byte
+	}
+}
@@ -0,0 +1,96 @@
+/**
+  ******************************************************************************
+  * @file    profiler.c
+  * @author  Bianchi Davide
+  * @brief   This file contains the cycle profiler of the audio path, read
+  *          at runtime with readProfiler() or with the debugger in profiler.
+  ******************************************************************************
+**/
+
+#include "utils/profiler.h"
+
+#ifdef SYNTH_PROFILER
+
+Profiler profiler;
+
+static void clearProfiler(void);
+
+/* ========== Constructor ========== */
+void setupProfiler(float sr) {
+	cycleCounterInit();
+	profiler.cycles_per_frame = (float)SystemCoreClock / sr;
+	profiler.sequence = 0;
+	profiler.reset_request = false;
+	memset(profiler.running, 0, sizeof(profiler.running));	// Left by the benchmarks
+	clearProfiler();
+}
+
+/* ========== Reader side (main loop, debugger) ========== */
+// Served by the audio path at the end of the next block
+void resetProfiler(void) {
+	profiler.reset_request = true;
+}
+
+// Retries while a block is committed: the audio path preempts the reader, never the opposite
+void readProfiler(ProfilerReport *report) {
+	uint32_t sequence;
+	do {
+		sequence = profiler.sequence;
+		__DMB();
+		for(int s = 0; s < PROFILE_STAGE_COUNT; s++) {
+			ProfilerStat *stat = &profiler.stats[s];
+			report->min_cycles[s]  = profiler.blocks ? stat->min : 0.0f;
+			report->max_cycles[s]  = stat->max;
+			report->mean_cycles[s] = profiler.blocks ? (float)stat->total / profiler.blocks : 0.0f;
+		}
+		report->blocks 		= profiler.blocks;
+		report->load 		= profiler.load;
+		report->max_load 	= profiler.max_load;
+		report->mean_load 	= profiler.frames ? 100.0f * profiler.stats[PROFILE_BLOCK].total / (profiler.frames * profiler.cycles_per_frame) : 0.0f;
+		__DMB();
+	} while((sequence & 1) || sequence != profiler.sequence);
+}
+
+/* ========== Writer side (audio path) ========== */
+// Commits the stages summed during the block of frames just rendered
+void profilerEndBlock(int frames) {
+	profiler.sequence++;
+	__DMB();
+
+	float period = frames * profiler.cycles_per_frame;	// 0 before setupProfiler()
+	float load = period > 0.0f ? 100.0f * profiler.running[PROFILE_BLOCK] / period : 0.0f;
+	if(profiler.reset_request) {
+		clearProfiler();
+		profiler.reset_request = false;
+	}
+	for(int s = 0; s < PROFILE_STAGE_COUNT; s++) {
+		ProfilerStat *stat = &profiler.stats[s];
+		uint32_t cycles = profiler.running[s];
+		stat->min = cycles < stat->min ? cycles : stat->min;
+		stat->max = cycles > stat->max ? cycles : stat->max;
+		stat->total += cycles;
+		profiler.running[s] = 0;
+	}
+	profiler.blocks++;
+	profiler.frames += frames;
+	profiler.load = load;
+	profiler.max_load = load > profiler.max_load ? load : profiler.max_load;
+
+	__DMB();
+	profiler.sequence++;
+}
+
+/* ========== Private functions ========== */
+static void clearProfiler(void) {
+	for(int s = 0; s < PROFILE_STAGE_COUNT; s++) {
+		profiler.stats[s].min 	= UINT32_MAX;
+		profiler.stats[s].max 	= 0;
+		profiler.stats[s].total = 0;
+	}
+	profiler.blocks 	= 0;
+	profiler.frames 	= 0;
+	profiler.load 		= 0.0f;
+	profiler.max_load 	= 0.0f;
+}
+
+#endif /* SYNTH_PROFILER */
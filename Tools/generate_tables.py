@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+"""
+******************************************************************************
+  @file    generate_tables.py
+  @author  Bianchi Davide
+  @brief   Generates the read-only DSP tables (Core/Src/dsp/tables.c) that are
+           shared by every instance of the synth components and live in flash.
+           Run it from the repository root after changing a table parameter:
+               python3 Tools/generate_tables.py
+******************************************************************************
+"""
+
+import math
+import os
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+OUT_FILE = os.path.join(ROOT, "Core", "Src", "dsp", "tables.c")
+
+# Must match Core/Inc/dsp/tables.h
+BLIT_TABLE_PHASES = 256     # Sub-sample resolution of the band-limited impulse
+BLIT_TABLE_TAPS = 16        # Length of each windowed sinc
+BLIT_CUTOFF = 0.45          # Cutoff of the sinc, relative to the sample rate
+TANH_TABLE_SIZE = 256       # Intervals of the tanh table
+TANH_TABLE_RANGE = 5.0      # The table covers [-TANH_TABLE_RANGE, +TANH_TABLE_RANGE]
+FILTER_TABLE_SIZE = 282     # Intervals of the filter coefficient table
+FILTER_TABLE_LOG2_MIN = -13.0   # log2(cutoff/sample rate) of the first row
+FILTER_TABLE_STEPS = 24     # Rows per octave
+SINE_TABLE_SIZE = 256       # Intervals of the LFO sine (power of 2)
+HALFBAND_1_TAPS = 12        # Odd-phase taps of the first 2x stage (47-tap half-band)
+HALFBAND_1_BETA = 7.0       # Kaiser window: passband 0.4*fs, -70 dB
+HALFBAND_2_TAPS = 4         # Odd-phase taps of the second 2x stage (15-tap half-band)
+HALFBAND_2_BETA = 6.5       # Kaiser window: the band is already below 0.2*fs, -65 dB
+
+
+def f32(value):
+    """Formats a value as a C float literal."""
+    text = "%.9g" % value
+    if "e" not in text and "." not in text:
+        text += ".0"
+    return text + "f"
+
+
+def blit_table():
+    """Windowed sinc (Hann-like window) for every sub-sample offset, normalized to unit sum."""
+    table = []
+    for phase in range(BLIT_TABLE_PHASES):
+        offset = phase / BLIT_TABLE_PHASES
+        row = []
+        for tap in range(BLIT_TABLE_TAPS):
+            t = tap - BLIT_TABLE_TAPS / 2 - offset
+            if t == 0.0:
+                value = 2.0 * math.pi * BLIT_CUTOFF
+            else:
+                value = math.sin(2.0 * math.pi * BLIT_CUTOFF * t) / t
+            value *= 0.51 - 0.49 * math.cos(2.0 * math.pi * (tap - offset) / BLIT_TABLE_TAPS)
+            row.append(value)
+        total = sum(row)
+        table.append([v / total for v in row])
+    return table
+
+
+def tanh_table():
+    """tanh sampled on TANH_TABLE_SIZE + 1 points, the last one is the guard for the interpolation."""
+    return [math.tanh(-TANH_TABLE_RANGE + 2.0 * TANH_TABLE_RANGE * i / TANH_TABLE_SIZE)
+            for i in range(TANH_TABLE_SIZE + 1)]
+
+
+def filter_table():
+    """Ladder coefficients {g, Glp, Gtot} with the bilinear prewarping g = tan(pi*fc/sr),
+    one row every 1/FILTER_TABLE_STEPS of octave of fc/sr, plus the guard row."""
+    table = []
+    for i in range(FILTER_TABLE_SIZE + 1):
+        g = math.tan(math.pi * 2.0 ** (FILTER_TABLE_LOG2_MIN + i / FILTER_TABLE_STEPS))
+        table.append([g, g / (1.0 + g), g ** 4])
+    return table
+
+
+def sine_table():
+    """One period of sin() on SINE_TABLE_SIZE + 1 points, the last one is the guard."""
+    return [math.sin(2.0 * math.pi * i / SINE_TABLE_SIZE) for i in range(SINE_TABLE_SIZE + 1)]
+
+
+def bessel_i0(x):
+    """Modified Bessel function of the first kind, order 0 (Kaiser window)."""
+    total = term = 1.0
+    for k in range(1, 50):
+        term *= (x / (2.0 * k)) ** 2
+        total += term
+    return total
+
+
+def halfband(taps, beta):
+    """Odd-phase coefficients h[c + 2j + 1], j = 0..taps-1, of a Kaiser-windowed half-band
+    of 4*taps - 1 taps. The centre tap is 0.5 and the even ones are zero, so they are not
+    stored. Normalized for unit gain at DC."""
+    length = 4 * taps
+    coeffs = []
+    for j in range(taps):
+        k = 2 * j + 1
+        h = math.sin(math.pi * k / 2.0) / (math.pi * k)
+        coeffs.append(h * bessel_i0(beta * math.sqrt(1.0 - (2.0 * k / length) ** 2)) / bessel_i0(beta))
+    total = sum(coeffs)
+    return [c * 0.25 / total for c in coeffs]
+
+
+def format_array(name, values, comment, per_line=8):
+    lines = ["/* %s */" % comment,
+             "const float %s[%d] = {" % (name, len(values))]
+    for i in range(0, len(values), per_line):
+        lines.append("\t" + ", ".join(f32(v) for v in values[i:i + per_line]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def format_matrix(name, rows, comment):
+    lines = ["/* %s */" % comment,
+             "const float %s[%d][%d] = {" % (name, len(rows), len(rows[0]))]
+    for row in rows:
+        lines.append("\t{" + ", ".join(f32(v) for v in row) + "},")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    header = """/**
+  ******************************************************************************
+  * @file    tables.c
+  * @author  Bianchi Davide
+  * @brief   This file contains the read-only tables shared by the dsp components.
+  *          GENERATED by Tools/generate_tables.py: do not edit by hand.
+  ******************************************************************************
+**/
+
+#include "dsp/tables.h"
+"""
+    sections = [
+        header,
+        "/* ========== BLIT ========== */",
+        format_matrix("blit_table", blit_table(),
+                      "Band-limited impulses, one row every 1/%d of sample" % BLIT_TABLE_PHASES),
+        "",
+        "/* ========== Saturator ========== */",
+        format_array("tanh_table", tanh_table(),
+                     "tanh(x) for x in [-%g, +%g]" % (TANH_TABLE_RANGE, TANH_TABLE_RANGE)),
+        "",
+        "/* ========== Filter ========== */",
+        format_matrix("filter_table", filter_table(),
+                      "{g, Glp, Gtot} for log2(fc/sr) from %g, %d rows per octave"
+                      % (FILTER_TABLE_LOG2_MIN, FILTER_TABLE_STEPS)),
+        "",
+        "/* ========== LFO ========== */",
+        format_array("sine_table", sine_table(), "sin(2*pi*x) for x in [0, 1]"),
+        "",
+        "/* ========== Oversampler ========== */",
+        format_array("halfband_1_table", halfband(HALFBAND_1_TAPS, HALFBAND_1_BETA),
+                     "Odd-phase taps of the first half-band stage (Kaiser, beta %g)" % HALFBAND_1_BETA),
+        format_array("halfband_2_table", halfband(HALFBAND_2_TAPS, HALFBAND_2_BETA),
+                     "Odd-phase taps of the second half-band stage (Kaiser, beta %g)" % HALFBAND_2_BETA),
+    ]
+    with open(OUT_FILE, "w", newline="\r\n") as out:
+        out.write("\n".join(sections) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""
+******************************************************************************
+  @file    map_report.py
+  @author  Bianchi Davide
+  @brief   Reads the linker map of a build and reports what went where:
+           the usage of every memory region, the state placed in CCM RAM
+           (CCM_DATA, the stack) and the kernels executed from SRAM
+           (RAM_FUNC), see Core/Inc/utils/memory_sections.h.
+           Run it from the repository root after a build:
+               python3 Tools/map_report.py [Debug/MicroMoog.map] [--top N]
+******************************************************************************
+"""
+
+import argparse
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+MAP_FILE = os.path.join(ROOT, "Debug", "MicroMoog.map")
+
+# Input sections listed one by one in the report
+PLACED_SECTIONS = (".ccmram", ".ccmbss", ".RamFunc")
+
+HEX = r"0x([0-9a-fA-F]+)"
+REGION_RE = re.compile(r"^(\w+)\s+" + HEX + r"\s+" + HEX)
+ADDRESS_RE = re.compile(r"^ ?(\S+)?\s+" + HEX + r"\s+" + HEX + r"(?:\s+load address " + HEX + r")?(?:\s+(\S.*))?$")
+SYMBOL_RE = re.compile(r"^\s+" + HEX + r"\s+([A-Za-z_][\w.$]*)\s*$")
+
+
+class Section:
+    def __init__(self, name, address, size, load=None, source=""):
+        self.name = name
+        self.address = address
+        self.size = size
+        self.load = load
+        self.source = source
+        self.symbols = []
+
+
+def parse_regions(lines):
+    """Returns {name: (origin, length)} from the Memory Configuration table."""
+    regions = {}
+    inside = False
+    for line in lines:
+        if line.startswith("Memory Configuration"):
+            inside = True
+        elif line.startswith("Linker script and memory map"):
+            break
+        elif inside:
+            match = REGION_RE.match(line)
+            if match and match.group(1) != "default":
+                regions[match.group(1)] = (int(match.group(2), 16), int(match.group(3), 16))
+    return regions
+
+
+def parse_sections(lines):
+    """Returns the output sections, each with its input sections and their symbols."""
+    outputs = []
+    pending_output = None
+    pending_input = None
+    current_input = None
+    inside = False
+    for line in lines:
+        if line.startswith("Linker script and memory map"):
+            inside = True
+            continue
+        if not inside or not line.strip():
+            continue
+
+        # Long names are printed alone and the addresses follow on the next line
+        if re.match(r"^\.\S+\s*$", line):
+            pending_output = line.strip()
+            continue
+        if re.match(r"^ (\.\S+|COMMON)\s*$", line):
+            pending_input = line.strip()
+            continue
+
+        match = ADDRESS_RE.match(line)
+        if match and not line.lstrip().startswith("*"):
+            name = match.group(1)
+            address, size = int(match.group(2), 16), int(match.group(3), 16)
+            load = int(match.group(4), 16) if match.group(4) else None
+            if line[0] != " " or (name is None and pending_output and not pending_input):
+                outputs.append(Section(name or pending_output, address, size, load))
+                current_input = None
+            elif outputs:
+                current_input = Section(name or pending_input, address, size, source=match.group(5) or "")
+                outputs[-1].symbols.append(current_input)
+            pending_output = None
+            pending_input = None
+            continue
+
+        match = SYMBOL_RE.match(line)
+        if match and current_input is not None:
+            current_input.symbols.append((int(match.group(1), 16), match.group(2)))
+    return outputs
+
+
+def find_region(regions, address):
+    for name, (origin, length) in regions.items():
+        if origin <= address < origin + length:
+            return name
+    return None
+
+
+def short_source(source):
+    return os.path.basename(source.split("(")[0]) + ("(" + source.split("(")[1] if "(" in source else "")
+
+
+def report(map_file, top):
+    with open(map_file) as f:
+        lines = f.read().splitlines()
+    regions = parse_regions(lines)
+    outputs = parse_sections(lines)
+
+    # Usage of every region, the initialized sections count in flash too
+    used = dict.fromkeys(regions, 0)
+    for out in outputs:
+        region = find_region(regions, out.address)
+        if region and out.size:
+            used[region] += out.size
+        if out.load is not None and out.load != out.address:
+            load_region = find_region(regions, out.load)
+            if load_region:
+                used[load_region] += out.size
+
+    print("%-8s %10s %10s %7s" % ("Region", "Used", "Size", "Use"))
+    for name, (origin, length) in regions.items():
+        print("%-8s %10d %10d %6.1f%%" % (name, used[name], length, 100.0 * used[name] / length))
+
+    inputs = [(out, inp) for out in outputs for inp in out.symbols if inp.size]
+
+    for section in PLACED_SECTIONS:
+        placed = [inp for out, inp in inputs if inp.name.startswith(section)]
+        if not placed:
+            continue
+        print("\n%s (%d bytes)" % (section, sum(inp.size for inp in placed)))
+        for inp in sorted(placed, key=lambda inp: inp.address):
+            names = ", ".join(symbol for _, symbol in inp.symbols) or inp.name
+            print("  0x%08x %7d  %-32s %s" % (inp.address, inp.size, names, short_source(inp.source)))
+
+    for out in outputs:
+        if out.name in ("._ccm_stack", "._user_heap_stack") and out.size:
+            print("\n%s reserves %d bytes at 0x%08x (%s)"
+                  % (out.name, out.size, out.address, find_region(regions, out.address)))
+
+    if top:
+        for name in regions:
+            largest = sorted((inp for out, inp in inputs if find_region(regions, inp.address) == name),
+                             key=lambda inp: -inp.size)[:top]
+            if largest:
+                print("\nLargest in %s" % name)
+                for inp in largest:
+                    names = ", ".join(symbol for _, symbol in inp.symbols) or inp.name
+                    print("  %7d  %-32s %s" % (inp.size, names, short_source(inp.source)))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Memory placement report of a linker map")
+    parser.add_argument("map_file", nargs="?", default=MAP_FILE)
+    parser.add_argument("--top", type=int, default=0, help="also list the N largest sections of every region")
+    args = parser.parse_args()
+    report(args.map_file, args.top)
+
+
+if __name__ == "__main__":
+    main()
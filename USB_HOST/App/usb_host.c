@@ -46,11 +46,12 @@ ApplicationTypeDef Appli_state = APPLICATION_IDLE;
  * -- Insert your variables declaration here --
  */
 /* USER CODE BEGIN 0 */
-void MIDI_UserProcess(uint8_t* midi_rx_buffer)
+void MIDI_UserProcess(uint8_t* midi_rx_buffer, MidiTxQueue* midi_tx_queue)
 {
 	if (Appli_state == APPLICATION_READY)
 	{
-		USBH_MIDI_Receive(&hUsbHostFS, midi_rx_buffer, MIDI_BUFF_SIZE);  // just once at the beginning, start the first reception
+		USBH_MIDI_Receive(&hUsbHostFS, midi_rx_buffer, MIDI_BUFF_SIZE);  // just once at the beginning, then the interrupt re-arms it (ping-pong)
+		USBH_MIDI_TransmitQueue(&hUsbHostFS, midi_tx_queue);             // just once, then sent from the queue by the class
 		Appli_state = APPLICATION_RUNNING;
 	}
 	if (Appli_state == APPLICATION_RUNNING)
@@ -23,7 +23,7 @@
 #include "usbh_platform.h"
 
 /* USER CODE BEGIN Includes */
-
+#include "driver/usbh_midi.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -90,7 +90,7 @@ void HAL_HCD_MspInit(HCD_HandleTypeDef* hcdHandle)
     __HAL_RCC_USB_OTG_FS_CLK_ENABLE();
 
     /* Peripheral interrupt init */
-    HAL_NVIC_SetPriority(OTG_FS_IRQn, 0, 0);
+    HAL_NVIC_SetPriority(OTG_FS_IRQn, 1, 0);
     HAL_NVIC_EnableIRQ(OTG_FS_IRQn);
   /* USER CODE BEGIN USB_OTG_FS_MspInit 1 */
 
@@ -167,6 +167,8 @@ void HAL_HCD_HC_NotifyURBChange_Callback(HCD_HandleTypeDef *hhcd, uint8_t chnum,
 #if (USBH_USE_OS == 1)
   USBH_LL_NotifyURBChange(hhcd->pData);
 #endif
+  /* MIDI reception re-armed from the interrupt, not from the USBH_Process() poll */
+  USBH_MIDI_NotifyURBChange(hhcd->pData, chnum, (USBH_URBStateTypeDef)urb_state);
 }
 /**
 * @brief  Port Port Enabled callback.